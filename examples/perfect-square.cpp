@@ -175,11 +175,37 @@ const int* specs[] = {
 const unsigned int n_specs = sizeof(specs) / sizeof(int*);
 //@}
 
+/**
+ * \brief %Options for %PerfectSquare problems
+ *
+ */
+class PerfectSquareOptions : public SizeOptions {
+private:
+  /// Scale factor
+  Driver::UnsignedIntOption _scale;
+public:
+  /// Initialize options for example with name \a s
+  PerfectSquareOptions(const char* s)
+    : SizeOptions(s),
+      _scale("scale","scale factor (pack scale*scale copies of all squares)",
+             1) {
+    add(_scale);
+  }
+  /// Return scale factor
+  unsigned int scale(void) const { return _scale.value(); }
+};
+
 /**
  * \brief %Example: Packing squares into a rectangle
  *
  * See problem 9 at http://www.csplib.org/.
  *
+ * With a scale factor \f$k\f$, \f$k^2\f$ copies of all squares are
+ * packed into a master square that is \f$k\f$ times as large. This
+ * yields large packing problems (for example, 1029 squares for the
+ * first specification and scale factor 7) for benchmarking the
+ * no-overlap constraint.
+ *
  * \ingroup Example
  */
 class PerfectSquare : public Script {
@@ -195,14 +221,23 @@ public:
     PROP_CUMULATIVES ///< Use cumulatives constraint
   };
   /// Actual model
-  PerfectSquare(const SizeOptions& opt)
+  PerfectSquare(const PerfectSquareOptions& opt)
     : Script(opt),
-      x(*this,specs[opt.size()][0],0,specs[opt.size()][1]-1),
-      y(*this,specs[opt.size()][0],0,specs[opt.size()][1]-1) {
+      x(*this,static_cast<int>(opt.scale()*opt.scale())*specs[opt.size()][0],
+        0,static_cast<int>(opt.scale())*specs[opt.size()][1]-1),
+      y(*this,static_cast<int>(opt.scale()*opt.scale())*specs[opt.size()][0],
+        0,static_cast<int>(opt.scale())*specs[opt.size()][1]-1) {
+
+    const int* ss = specs[opt.size()];
+    int k = static_cast<int>(opt.scale());
+    int m = ss[0];
+    int n = k*k*m;
+    int w = k*ss[1];
 
-    const int* s = specs[opt.size()];
-    int n = *s++;
-    int w = *s++;
+    // Sizes of squares (all copies)
+    IntArgs s(n);
+    for (int i=0; i<n; i++)
+      s[i] = ss[2+(i % m)];
 
     // Restrict position according to square size
     for (int i=0; i<n; i++) {
@@ -210,10 +245,8 @@ public:
       rel(*this, y[i], IRT_LQ, w-s[i]);
     }
 
-    IntArgs sa(n,s);
-
     // Squares do not overlap
-    nooverlap(*this, x, sa, y, sa);
+    nooverlap(*this, x, s, y, s);
 
     /*
      * Capacity constraints
@@ -226,13 +259,13 @@ public:
           BoolVarArgs bx(*this,n,0,1);
           for (int i=0; i<n; i++)
             dom(*this, x[i], cx-s[i]+1, cx, bx[i]);
-          linear(*this, sa, bx, IRT_EQ, w);
+          linear(*this, s, bx, IRT_EQ, w);
         }
         for (int cy=0; cy<w; cy++) {
           BoolVarArgs by(*this,n,0,1);
           for (int i=0; i<n; i++)
             dom(*this, y[i], cy-s[i]+1, cy, by[i]);
-          linear(*this, sa, by, IRT_EQ, w);
+          linear(*this, s, by, IRT_EQ, w);
         }
       }
       break;
@@ -294,7 +327,7 @@ public:
  */
 int
 main(int argc, char* argv[]) {
-  SizeOptions opt("PerfectSquare");
+  PerfectSquareOptions opt("PerfectSquare");
   opt.propagation(PerfectSquare::PROP_REIFIED);
   opt.propagation(PerfectSquare::PROP_REIFIED,     "reified");
   opt.propagation(PerfectSquare::PROP_CUMULATIVES, "cumulatives");
@@ -306,7 +339,11 @@ main(int argc, char* argv[]) {
               << std::endl;
     return 1;
   }
-  Script::run<PerfectSquare,DFS,SizeOptions>(opt);
+  if (opt.scale() < 1) {
+    std::cerr << "Error: scale must be at least 1" << std::endl;
+    return 1;
+  }
+  Script::run<PerfectSquare,DFS,PerfectSquareOptions>(opt);
   return 0;
 }
 
@@ -81,8 +81,11 @@ public:
  * no such assignment exists.
  *
  * This example parses a dimacs CNF file in which
- * the constraints are specified. For each line of
- * the file a clause propagator is posted.
+ * the constraints are specified. Either a clause
+ * propagator is posted for each line of the file,
+ * or all clauses are posted as a single clause
+ * database (which optionally learns clauses from
+ * failures).
  *
  * Format of dimacs CNF files:
  *
@@ -113,11 +116,21 @@ private:
   /// The Boolean variables
   BoolVarArray x;
 public:
+  /// Propagation to use for model
+  enum {
+    PROP_CLAUSE,   ///< Use a propagator per clause
+    PROP_DATABASE, ///< Use a single propagator for all clauses
+    PROP_LEARN     ///< Use a single propagator that learns clauses
+  };
   /// The actual problem
   Sat(const SatOptions& opt)
     : Script(opt) {
-    parseDIMACS(opt.filename.c_str());
-    branch(*this, x, BOOL_VAR_AFC_MAX(), BOOL_VAL_MIN());
+    parseDIMACS(opt.filename.c_str(), opt.propagation());
+    if (opt.propagation() != PROP_CLAUSE)
+      // AFC is per propagator and hence uninformative for a single database
+      branch(*this, x, BOOL_VAR_ACTION_MAX(0.95), BOOL_VAL_MIN());
+    else
+      branch(*this, x, BOOL_VAR_AFC_MAX(), BOOL_VAL_MIN());
   }
 
   /// Constructor for cloning
@@ -137,8 +150,9 @@ public:
     os << "solution:\n" << x << std::endl;
   }
 
-  /// Post constraints according to DIMACS file \a f
-  void parseDIMACS(const char* f) {
+  /// Post constraints according to DIMACS file \a f and propagation \a p
+  void parseDIMACS(const char* f, int p) {
+    bool db = (p != PROP_CLAUSE);
     int variables = 0;
     int clauses = 0;
     std::ifstream dimacs(f);
@@ -150,6 +164,8 @@ public:
               << std::endl;
     std::string line;
     int c = 0;
+    // All clauses in DIMACS format when posting a database
+    std::vector<int> cnf;
     while (dimacs.good()) {
       std::getline(dimacs,line);
       // Comments (ignore them)
@@ -202,10 +218,17 @@ public:
               pos.push_back(value-1);
             else
               neg.push_back(value-1);
+            if (db)
+              cnf.push_back(positive ? value : -value);
             i++;
           }
         }
 
+        if (db) {
+          cnf.push_back(0);
+          continue;
+        }
+
         // Create positive BoolVarArgs
         BoolVarArgs positives(pos.size());
         for (int i=pos.size(); i--;)
@@ -230,6 +253,9 @@ public:
                 << std::endl;
       std::exit(EXIT_FAILURE);
     }
+    if (db)
+      clause(*this, x, IntArgs(cnf),
+             (p == PROP_LEARN) ? IPL_ADVANCED : IPL_DEF);
   }
 };
 
@@ -240,6 +266,13 @@ public:
 int main(int argc, char* argv[]) {
 
   SatOptions opt("SAT");
+  opt.propagation(Sat::PROP_CLAUSE);
+  opt.propagation(Sat::PROP_CLAUSE, "clause",
+                  "use a propagator per clause");
+  opt.propagation(Sat::PROP_DATABASE, "database",
+                  "use a single clause database propagator");
+  opt.propagation(Sat::PROP_LEARN, "learn",
+                  "use a single clause database propagator with learning");
   opt.parse(argc,argv);
 
   // Check whether all arguments are successfully parsed
@@ -583,6 +583,32 @@ AC_DEFUN([AC_GECODE_AUDIT],
      fi])
 
 
+AC_DEFUN([AC_GECODE_BATCH_QUEUE],
+    [AC_ARG_ENABLE([batch-queue],
+       AC_HELP_STRING([--enable-batch-queue],
+         [build with batched propagator queues @<:@default=no@:>@]))
+     AC_MSG_CHECKING(whether to build with batched propagator queues)
+     if test "${enable_batch_queue:-no}" = "yes"; then
+        AC_DEFINE([GECODE_BATCH_QUEUE],[],
+                  [Whether to use batched propagator queues with cached cost])
+        AC_MSG_RESULT(yes)
+     else
+        AC_MSG_RESULT(no)
+     fi])
+
+AC_DEFUN([AC_GECODE_PROP_PROFILE],
+    [AC_ARG_ENABLE([prop-profile],
+       AC_HELP_STRING([--enable-prop-profile],
+         [build with profiling of propagator executions @<:@default=no@:>@]))
+     AC_MSG_CHECKING(whether to build with profiling of propagator executions)
+     if test "${enable_prop_profile:-no}" = "yes"; then
+        AC_DEFINE([GECODE_PROP_PROFILE],[],
+                  [Whether to profile propagator executions])
+        AC_MSG_RESULT(yes)
+     else
+        AC_MSG_RESULT(no)
+     fi])
+
 AC_DEFUN([AC_GECODE_PROFILE],
      [AC_ARG_ENABLE([profile],
        AC_HELP_STRING([--enable-profile],
@@ -397,6 +397,8 @@ namespace Gecode {
     Driver::UnsignedIntOption _nogoods_limit; ///< Limit for no-good extraction
     Driver::DoubleOption      _relax;         ///< Probability to relax variable
     Driver::BoolOption        _interrupt;     ///< Whether to catch SIGINT
+    Driver::StringValueOption _checkpoint;    ///< Where to save checkpoints
+    Driver::UnsignedIntOption _checkpoint_time; ///< Time between checkpoints
     //@}
 
     /// \name Execution options
@@ -565,6 +567,15 @@ namespace Gecode {
     void interrupt(bool b);
     /// Return interrupt behavior
     bool interrupt(void) const;
+
+    /// Set default checkpoint file name
+    void checkpoint(const char* f);
+    /// Return checkpoint file name (NULL if none)
+    const char* checkpoint(void) const;
+    /// Set default time between checkpoints (in milliseconds)
+    void checkpoint_time(unsigned int t);
+    /// Return time between checkpoints (in milliseconds)
+    unsigned int checkpoint_time(void) const;
     //@}
 
     /// \name Execution options
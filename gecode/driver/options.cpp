@@ -599,6 +599,10 @@ namespace Gecode {
       _relax("relax","probability for relaxing variable", 0.0),
       _interrupt("interrupt","whether to catch Ctrl-C (true) or not (false)",
                  true),
+      _checkpoint("checkpoint","file to save search checkpoints to and "
+                  "resume search from (solution mode)"),
+      _checkpoint_time("checkpoint-time",
+                       "time (in ms) between checkpoints",60000),
 
       _mode("mode","how to execute script",SM_SOLUTION),
       _samples("samples","how many samples (time mode)",1),
@@ -638,6 +642,7 @@ namespace Gecode {
     add(_search); add(_solutions); add(_threads); add(_c_d); add(_a_d);
     add(_d_l);
     add(_node); add(_fail); add(_time); add(_interrupt);
+    add(_checkpoint); add(_checkpoint_time);
     add(_assets); add(_slice);
     add(_restart); add(_r_base); add(_r_scale);
     add(_nogoods); add(_nogoods_limit);
@@ -434,6 +434,24 @@ namespace Gecode {
     return _interrupt.value();
   }
 
+  inline void
+  Options::checkpoint(const char* f) {
+    _checkpoint.value(f);
+  }
+  inline const char*
+  Options::checkpoint(void) const {
+    return _checkpoint.value();
+  }
+
+  inline void
+  Options::checkpoint_time(unsigned int t) {
+    _checkpoint_time.value(t);
+  }
+  inline unsigned int
+  Options::checkpoint_time(void) const {
+    return _checkpoint_time.value();
+  }
+
 
   /*
    * Execution options
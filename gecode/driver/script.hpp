@@ -52,13 +52,16 @@ namespace Gecode { namespace Driver {
     Search::NodeStop* ns; ///< Used node stop object
     Search::FailStop* fs; ///< Used fail stop object
     Search::TimeStop* ts; ///< Used time stop object
+    Search::TimeStop* cs; ///< Used time stop object for checkpoints
     GECODE_DRIVER_EXPORT
     static bool sigint;   ///< Whether search was interrupted using Ctrl-C
     /// Initialize stop object
-    CombinedStop(unsigned int node, unsigned int fail, unsigned int time)
+    CombinedStop(unsigned int node, unsigned int fail, unsigned int time,
+                 unsigned int ckpt)
       : ns((node > 0) ? new Search::NodeStop(node) : NULL),
         fs((fail > 0) ? new Search::FailStop(fail) : NULL),
-        ts((time > 0) ? new Search::TimeStop(time) : NULL) {
+        ts((time > 0) ? new Search::TimeStop(time) : NULL),
+        cs((ckpt > 0) ? new Search::TimeStop(ckpt) : NULL) {
       sigint = false;
     }
   public:
@@ -67,7 +70,8 @@ namespace Gecode { namespace Driver {
       SR_NODE = 1 << 0, ///< Node limit reached
       SR_FAIL = 1 << 1, ///< Fail limit reached
       SR_TIME = 1 << 2, ///< Time limit reached
-      SR_INT  = 1 << 3  ///< Interrupted by user
+      SR_INT  = 1 << 3, ///< Interrupted by user
+      SR_CKPT = 1 << 4  ///< Checkpoint is due
     };
     /// Test whether search must be stopped
     virtual bool stop(const Search::Statistics& s, const Search::Options& o) {
@@ -75,7 +79,8 @@ namespace Gecode { namespace Driver {
         sigint ||
         ((ns != NULL) && ns->stop(s,o)) ||
         ((fs != NULL) && fs->stop(s,o)) ||
-        ((ts != NULL) && ts->stop(s,o));
+        ((ts != NULL) && ts->stop(s,o)) ||
+        ((cs != NULL) && cs->stop(s,o));
     }
     /// Report reason why search has been stopped
     int reason(const Search::Statistics& s, const Search::Options& o) {
@@ -83,16 +88,23 @@ namespace Gecode { namespace Driver {
         (((ns != NULL) && ns->stop(s,o)) ? SR_NODE : 0) |
         (((fs != NULL) && fs->stop(s,o)) ? SR_FAIL : 0) |
         (((ts != NULL) && ts->stop(s,o)) ? SR_TIME : 0) |
+        (((cs != NULL) && cs->stop(s,o)) ? SR_CKPT : 0) |
         (sigint                          ? SR_INT  : 0);
     }
+    /// Restart time until next checkpoint is due
+    void checkpointed(void) {
+      if (cs != NULL)
+        cs->reset();
+    }
     /// Create appropriate stop-object
     static Search::Stop*
     create(unsigned int node, unsigned int fail, unsigned int time,
-           bool intr) {
-      if ( (!intr) && (node == 0) && (fail == 0) && (time == 0))
+           bool intr, unsigned int ckpt=0) {
+      if ( (!intr) && (node == 0) && (fail == 0) && (time == 0) &&
+           (ckpt == 0))
         return NULL;
       else
-        return new CombinedStop(node,fail,time);
+        return new CombinedStop(node,fail,time,ckpt);
     }
 #ifdef GECODE_THREADS_WINDOWS
     /// Handler for catching Ctrl-C
@@ -124,10 +136,40 @@ namespace Gecode { namespace Driver {
     }
     /// Destructor
     ~CombinedStop(void) {
-      delete ns; delete fs; delete ts;
+      delete ns; delete fs; delete ts; delete cs;
     }
   };
 
+  /**
+   * \brief Return next solution of engine \a e and save checkpoints
+   *
+   * If a checkpoint file is given in the options \a o, a checkpoint
+   * is saved whenever a solution has been found, a checkpoint is due,
+   * or search has finished or has been stopped.
+   */
+  template<class Script, class Engine, class Options>
+  inline Script*
+  checkpointnext(Engine& e, const Options& o, const Search::Options& so) {
+    while (true) {
+      Script* s = e.next();
+      if (o.checkpoint() == NULL)
+        return s;
+      Archive a;
+      e.checkpoint(a);
+      if (!Search::savecheckpoint(o.checkpoint(),a))
+        std::cerr << "Could not save checkpoint to "
+                  << o.checkpoint() << std::endl;
+      if ((s == NULL) && e.stopped()) {
+        CombinedStop* cs = static_cast<CombinedStop*>(so.stop);
+        if (cs->reason(e.statistics(),so) == CombinedStop::SR_CKPT) {
+          cs->checkpointed();
+          continue;
+        }
+      }
+      return s;
+    }
+  }
+
   /**
    * \brief Get time since start of timer and print user friendly time
    * information.
@@ -376,7 +418,9 @@ namespace Gecode { namespace Driver {
           so.assets  = o.assets();
           so.slice   = o.slice();
           so.stop    = CombinedStop::create(o.node(),o.fail(), o.time(),
-                                            o.interrupt());
+                                            o.interrupt(),
+                                            (o.checkpoint() != NULL) ?
+                                            o.checkpoint_time() : 0U);
           so.cutoff  = createCutoff(o);
           so.clone   = false;
           so.nogoods_limit = o.nogoods() ? o.nogoods_limit() : 0U;
@@ -384,10 +428,17 @@ namespace Gecode { namespace Driver {
             CombinedStop::installCtrlHandler(true);
           {
             Meta<Script,Engine> e(s,so);
+            if (o.checkpoint() != NULL) {
+              Archive a;
+              if (Search::loadcheckpoint(o.checkpoint(),a)) {
+                e.restore(a);
+                l_out << "\tresumed from " << o.checkpoint() << endl;
+              }
+            }
             if (o.print_last()) {
               Script* px = NULL;
               do {
-                Script* ex = e.next();
+                Script* ex = checkpointnext<Script>(e,o,so);
                 if (ex == NULL) {
                   if (px != NULL) {
                     px->print(s_out);
@@ -401,7 +452,7 @@ namespace Gecode { namespace Driver {
               } while (--i != 0);
             } else {
               do {
-                Script* ex = e.next();
+                Script* ex = checkpointnext<Script>(e,o,so);
                 if (ex == NULL)
                   break;
                 ex->print(s_out);
@@ -444,6 +495,15 @@ namespace Gecode { namespace Driver {
                   << "\trestarts:     " << stat.restart << endl
                   << "\tno-goods:     " << stat.nogood << endl
                   << "\tpeak depth:   " << stat.depth << endl
+                  << "\tcloned:       "
+                  << (stat.clone_bytes+1023) / 1024 << " KB" << endl;
+            if (so.threads != 1.0)
+              l_out << "\tsteals:       " << stat.steal_ok
+                    << " (" << stat.steal_fail << " unsuccessful)" << endl
+                    << "\tchunk reuse:  " << Kernel::SharedMemory::reused()
+                    << " (" << Kernel::SharedMemory::waited()
+                    << " lock waits)" << endl;
+            l_out
 #ifdef GECODE_PEAKHEAP
                   << "\tpeak memory:  "
                   << static_cast<int>((heap.peak()+1023) / 1024) << " KB"
@@ -460,6 +520,9 @@ namespace Gecode { namespace Driver {
           l_out << o.name() << endl;
           Support::Timer t;
           int i = static_cast<int>(o.solutions());
+#ifdef GECODE_PROP_PROFILE
+          PropagatorProfile::reset();
+#endif
           t.start();
           if (s == NULL)
             s = new Script(o);
@@ -504,12 +567,25 @@ namespace Gecode { namespace Driver {
                   << "\trestarts:     " << stat.restart << endl
                   << "\tno-goods:     " << stat.nogood << endl
                   << "\tpeak depth:   " << stat.depth << endl
+                  << "\tcloned:       "
+                  << (stat.clone_bytes+1023) / 1024 << " KB" << endl;
+            if (so.threads != 1.0)
+              l_out << "\tsteals:       " << stat.steal_ok
+                    << " (" << stat.steal_fail << " unsuccessful)" << endl
+                    << "\tchunk reuse:  " << Kernel::SharedMemory::reused()
+                    << " (" << Kernel::SharedMemory::waited()
+                    << " lock waits)" << endl;
+            l_out
 #ifdef GECODE_PEAKHEAP
                   << "\tpeak memory:  "
                   << static_cast<int>((heap.peak()+1023) / 1024) << " KB"
                   << endl
 #endif
                   << endl;
+#ifdef GECODE_PROP_PROFILE
+            PropagatorProfile::print(l_out);
+            l_out << endl;
+#endif
           }
           delete so.stop;
         }
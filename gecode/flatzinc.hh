@@ -253,6 +253,7 @@ namespace Gecode { namespace FlatZinc {
       Gecode::Driver::StringOption      _mode;       ///< Script mode to run
       Gecode::Driver::BoolOption        _stat;       ///< Emit statistics
       Gecode::Driver::StringValueOption _output;     ///< Output file
+      Gecode::Driver::BoolOption        _stream;     ///< Post constraints while parsing
 
 #ifdef GECODE_HAS_CPPROFILER
 
@@ -291,7 +292,8 @@ namespace Gecode { namespace FlatZinc {
       _step("step","step distance for float optimization",0.0),
       _mode("mode","how to execute script",Gecode::SM_SOLUTION),
       _stat("s","emit statistics"),
-      _output("o","file to send output to")
+      _output("o","file to send output to"),
+      _stream("stream","post constraints while parsing",false)
 
 #ifdef GECODE_HAS_CPPROFILER
       ,
@@ -321,7 +323,7 @@ namespace Gecode { namespace FlatZinc {
       add(_restart); add(_r_base); add(_r_scale);
       add(_nogoods); add(_nogoods_limit);
       add(_mode); add(_stat);
-      add(_output);
+      add(_output); add(_stream);
 #ifdef GECODE_HAS_CPPROFILER
       add(_profiler_id);
       add(_profiler_port);
@@ -360,6 +362,7 @@ namespace Gecode { namespace FlatZinc {
     int seed(void) const { return _seed.value(); }
     double step(void) const { return _step.value(); }
     const char* output(void) const { return _output.value(); }
+    bool stream(void) const { return _stream.value(); }
 
     Gecode::ScriptMode mode(void) const {
       return static_cast<Gecode::ScriptMode>(_mode.value());
@@ -519,6 +522,10 @@ namespace Gecode { namespace FlatZinc {
 #endif
     /// Whether the introduced variables still need to be copied
     bool needAuxVars;
+    /// Time for parsing and posting (in milliseconds)
+    double parseTime;
+    /// Peak memory of the process after parsing (in KB, 0 if unknown)
+    unsigned long int parseMemory;
     /// Construct empty space
     FlatZincSpace(Rnd& random = defrnd);
 
@@ -541,8 +548,10 @@ namespace Gecode { namespace FlatZinc {
     /// Create new float variable from specification
     void newFloatVar(FloatVarSpec* vs);
 
-    /// Post a constraint specified by \a ce
+    /// Post constraints specified by \a ces
     void postConstraints(std::vector<ConExpr*>& ces);
+    /// Post a constraint specified by \a ce
+    void postConstraint(const ConExpr& ce);
 
     /// Post the solve item
     void solve(AST::Array* annotation);
@@ -674,22 +683,28 @@ namespace Gecode { namespace FlatZinc {
   /**
    * \brief Parse FlatZinc file \a fileName into \a fzs and return it.
    *
-   * Creates a new empty FlatZincSpace if \a fzs is NULL.
+   * Creates a new empty FlatZincSpace if \a fzs is NULL. If \a stream
+   * is true, each constraint is posted as soon as it has been parsed
+   * (variables are then not aliased by equality constraints).
    */
   GECODE_FLATZINC_EXPORT
   FlatZincSpace* parse(const std::string& fileName,
                        Printer& p, std::ostream& err = std::cerr,
-                       FlatZincSpace* fzs=NULL, Rnd& rnd=defrnd);
+                       FlatZincSpace* fzs=NULL, Rnd& rnd=defrnd,
+                       bool stream=false);
 
   /**
    * \brief Parse FlatZinc from \a is into \a fzs and return it.
    *
-   * Creates a new empty FlatZincSpace if \a fzs is NULL.
+   * Creates a new empty FlatZincSpace if \a fzs is NULL. If \a stream
+   * is true, each constraint is posted as soon as it has been parsed
+   * (variables are then not aliased by equality constraints).
    */
   GECODE_FLATZINC_EXPORT
   FlatZincSpace* parse(std::istream& is,
                        Printer& p, std::ostream& err = std::cerr,
-                       FlatZincSpace* fzs=NULL, Rnd& rnd=defrnd);
+                       FlatZincSpace* fzs=NULL, Rnd& rnd=defrnd,
+                       bool stream=false);
 
 }}
 
@@ -778,7 +778,8 @@ namespace Gecode { namespace FlatZinc {
 #ifdef GECODE_HAS_FLOAT_VARS
       step(f.step),
 #endif
-      needAuxVars(f.needAuxVars) {
+      needAuxVars(f.needAuxVars), parseTime(f.parseTime),
+      parseMemory(f.parseMemory) {
       _optVar = f._optVar;
       _optVarIsInt = f._optVarIsInt;
       _method = f._method;
@@ -848,7 +849,8 @@ namespace Gecode { namespace FlatZinc {
     intVarCount(-1), boolVarCount(-1), floatVarCount(-1), setVarCount(-1),
     _optVar(-1), _optVarIsInt(true), _lns(0), _lnsInitialSolution(0),
     _random(random),
-    _solveAnnotations(NULL), needAuxVars(true) {
+    _solveAnnotations(NULL), needAuxVars(true),
+    parseTime(0.0), parseMemory(0UL) {
     branchInfo.init();
   }
 
@@ -1006,19 +1008,23 @@ namespace Gecode { namespace FlatZinc {
     std::sort(ces.begin(), ces.end(), ceo);
 
     for (unsigned int i=0; i<ces.size(); i++) {
-      const ConExpr& ce = *ces[i];
-      try {
-        registry().post(*this, ce);
-      } catch (Gecode::Exception& e) {
-        throw FlatZinc::Error("Gecode", e.what());
-      } catch (AST::TypeError& e) {
-        throw FlatZinc::Error("Type error", e.what());
-      }
+      postConstraint(*ces[i]);
       delete ces[i];
       ces[i] = NULL;
     }
   }
 
+  void
+  FlatZincSpace::postConstraint(const ConExpr& ce) {
+    try {
+      registry().post(*this, ce);
+    } catch (Gecode::Exception& e) {
+      throw FlatZinc::Error("Gecode", e.what());
+    } catch (AST::TypeError& e) {
+      throw FlatZinc::Error("Type error", e.what());
+    }
+  }
+
   void flattenAnnotations(AST::Array* ann, std::vector<AST::Node*>& out) {
       for (unsigned int i=0; i<ann->a.size(); i++) {
         if (ann->a[i]->isCall("seq_search")) {
@@ -1906,6 +1912,11 @@ namespace Gecode { namespace FlatZinc {
         out << std::endl
             << "%%%mzn-stat initTime=" << initTime
             << std::endl;      
+        out << "%%%mzn-stat parseTime=" << (parseTime / 1000.0)
+            << std::endl;
+        if (parseMemory > 0)
+          out << "%%%mzn-stat parsePeakMemory=" << parseMemory << "KB"
+              << std::endl;
         out << "%%%mzn-stat solveTime=" << solveTime
             << std::endl;
         out << "%%%mzn-stat solutions="
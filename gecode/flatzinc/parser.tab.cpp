@@ -79,6 +79,7 @@
 #include <sys/types.h>
 #include <sys/mman.h>
 #include <sys/stat.h>
+#include <sys/resource.h>
 #endif
 
 using namespace std;
@@ -292,7 +293,10 @@ int getBaseSetVar(ParserState* pp, int i) {
  *
  */
 
-void initfg(ParserState* pp) {
+void initvars(ParserState* pp) {
+  if (pp->initialized)
+    return;
+  pp->initialized = true;
   if (!pp->hadError)
     pp->fg->init(pp->intvars.size(),
                  pp->boolvars.size(),
@@ -345,12 +349,41 @@ void initfg(ParserState* pp) {
     delete pp->floatvars[i].second;
     pp->floatvars[i].second = NULL;
   }
+}
+
+void initfg(ParserState* pp) {
+  initvars(pp);
   if (!pp->hadError) {
     pp->fg->postConstraints(pp->domainConstraints);
     pp->fg->postConstraints(pp->constraints);
   }
 }
 
+void postStream(ParserState* pp, char* id, AST::Array* args,
+                AST::Array* ann) {
+  // All variables have been declared before the first constraint
+  initvars(pp);
+  if (!pp->hadError) {
+    pp->fg->postConstraints(pp->domainConstraints);
+    pp->domainConstraints.clear();
+    ConExpr ce(id, args, ann);
+    pp->fg->postConstraint(ce);
+  }
+}
+
+unsigned long int peakMemory(void) {
+#ifdef HAVE_MMAP
+  struct rusage ru;
+  if (getrusage(RUSAGE_SELF, &ru) == 0)
+#ifdef __APPLE__
+    return static_cast<unsigned long int>(ru.ru_maxrss / 1024);
+#else
+    return static_cast<unsigned long int>(ru.ru_maxrss);
+#endif
+#endif
+  return 0;
+}
+
 void fillPrinter(ParserState& pp, Gecode::FlatZinc::Printer& p) {
   p.init(pp.getOutput());
   for (unsigned int i=0; i<pp.intvars.size(); i++) {
@@ -423,7 +456,9 @@ AST::Node* arrayOutput(AST::Call* ann) {
 namespace Gecode { namespace FlatZinc {
 
   FlatZincSpace* parse(const std::string& filename, Printer& p, std::ostream& err,
-                       FlatZincSpace* fzs, Rnd& rnd) {
+                       FlatZincSpace* fzs, Rnd& rnd, bool stream) {
+    Support::Timer t;
+    t.start();
 #ifdef HAVE_MMAP
     int fd;
     char* data;
@@ -435,13 +470,19 @@ namespace Gecode { namespace FlatZinc {
     }
     if (stat(filename.c_str(), &sbuf) == -1) {
       err << "Cannot stat file " << filename << endl;
+      close(fd);
       return NULL;
     }
     data = (char*)mmap((caddr_t)0, sbuf.st_size, PROT_READ, MAP_SHARED, fd,0);
     if (data == (caddr_t)(-1)) {
       err << "Cannot mmap file " << filename << endl;
+      close(fd);
       return NULL;
     }
+#ifdef MADV_SEQUENTIAL
+    // The file is read sequentially
+    (void) madvise(data, sbuf.st_size, MADV_SEQUENTIAL);
+#endif
 
     if (fzs == NULL) {
       fzs = new FlatZincSpace(rnd);
@@ -461,6 +502,7 @@ namespace Gecode { namespace FlatZinc {
     }
     ParserState pp(s, err, fzs);
 #endif
+    pp.stream = stream;
     yylex_init(&pp.yyscanner);
     yyset_extra(&pp, pp.yyscanner);
     // yydebug = 1;
@@ -469,11 +511,19 @@ namespace Gecode { namespace FlatZinc {
 
     if (pp.yyscanner)
       yylex_destroy(pp.yyscanner);
+#ifdef HAVE_MMAP
+    munmap(data, sbuf.st_size);
+    close(fd);
+#endif
+    pp.fg->parseTime = t.stop();
+    pp.fg->parseMemory = peakMemory();
     return pp.hadError ? NULL : pp.fg;
   }
 
   FlatZincSpace* parse(std::istream& is, Printer& p, std::ostream& err,
-                       FlatZincSpace* fzs, Rnd& rnd) {
+                       FlatZincSpace* fzs, Rnd& rnd, bool stream) {
+    Support::Timer t;
+    t.start();
     std::string s = string(istreambuf_iterator<char>(is),
                            istreambuf_iterator<char>());
 
@@ -481,6 +531,7 @@ namespace Gecode { namespace FlatZinc {
       fzs = new FlatZincSpace(rnd);
     }
     ParserState pp(s, err, fzs);
+    pp.stream = stream;
     yylex_init(&pp.yyscanner);
     yyset_extra(&pp, pp.yyscanner);
     // yydebug = 1;
@@ -489,13 +540,15 @@ namespace Gecode { namespace FlatZinc {
 
     if (pp.yyscanner)
       yylex_destroy(pp.yyscanner);
+    pp.fg->parseTime = t.stop();
+    pp.fg->parseMemory = peakMemory();
     return pp.hadError ? NULL : pp.fg;
   }
 
 }}
 
 
-#line 499 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:339  */
+#line 552 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:339  */
 
 # ifndef YY_NULLPTR
 #  if defined __cplusplus && 201103L <= __cplusplus
@@ -583,7 +636,7 @@ extern int yydebug;
 
 union YYSTYPE
 {
-#line 470 "gecode/flatzinc/parser.yxx" /* yacc.c:355  */
+#line 523 "gecode/flatzinc/parser.yxx" /* yacc.c:355  */
  int iValue; char* sValue; bool bValue; double dValue;
          std::vector<int>* setValue;
          Gecode::FlatZinc::AST::SetLit* setLit;
@@ -599,7 +652,7 @@ union YYSTYPE
          Gecode::FlatZinc::AST::Array* argVec;
        
 
-#line 603 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:355  */
+#line 656 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:355  */
 };
 
 typedef union YYSTYPE YYSTYPE;
@@ -615,7 +668,7 @@ int yyparse (void *parm);
 
 /* Copy the second part of user declarations.  */
 
-#line 619 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:358  */
+#line 672 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:358  */
 
 #ifdef short
 # undef short
@@ -1957,31 +2010,31 @@ yyreduce:
   switch (yyn)
     {
         case 15:
-#line 604 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 657 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { free((yyvsp[-3].sValue)); }
-#line 1963 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2016 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 20:
-#line 616 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 669 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { free((yyvsp[0].sValue)); }
-#line 1969 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2022 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 25:
-#line 626 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 679 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { if ((yyvsp[0].oSet)()) delete (yyvsp[0].oSet).some(); }
-#line 1975 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2028 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 26:
-#line 628 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 681 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { if ((yyvsp[0].oSet)()) delete (yyvsp[0].oSet).some(); }
-#line 1981 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2034 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 35:
-#line 648 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 701 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState* pp = static_cast<ParserState*>(parm);
         bool print = (yyvsp[-1].argVec) != NULL && (yyvsp[-1].argVec)->hasAtom("output_var");
@@ -2013,11 +2066,11 @@ yyreduce:
         }
         delete (yyvsp[-1].argVec); free((yyvsp[-2].sValue));
       }
-#line 2017 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2070 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 36:
-#line 680 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 733 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState* pp = static_cast<ParserState*>(parm);
         bool print = (yyvsp[-1].argVec) != NULL && (yyvsp[-1].argVec)->hasAtom("output_var");
@@ -2049,11 +2102,11 @@ yyreduce:
         }
         delete (yyvsp[-1].argVec); free((yyvsp[-2].sValue));
       }
-#line 2053 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2106 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 37:
-#line 712 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 765 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState* pp = static_cast<ParserState*>(parm);
         bool print = (yyvsp[-1].argVec) != NULL && (yyvsp[-1].argVec)->hasAtom("output_var");
@@ -2092,11 +2145,11 @@ yyreduce:
         }
         delete (yyvsp[-1].argVec); free((yyvsp[-2].sValue));
       }
-#line 2096 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2149 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 38:
-#line 751 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 804 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState* pp = static_cast<ParserState*>(parm);
         bool print = (yyvsp[-1].argVec) != NULL && (yyvsp[-1].argVec)->hasAtom("output_var");
@@ -2129,11 +2182,11 @@ yyreduce:
         }
         delete (yyvsp[-1].argVec); free((yyvsp[-2].sValue));
       }
-#line 2133 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2186 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 39:
-#line 784 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 837 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState* pp = static_cast<ParserState*>(parm);
         yyassert(pp, (yyvsp[0].arg)->isInt(), "Invalid int initializer");
@@ -2142,11 +2195,11 @@ yyreduce:
           "Duplicate symbol");
         delete (yyvsp[-2].argVec); free((yyvsp[-3].sValue));
       }
-#line 2146 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2199 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 40:
-#line 793 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 846 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState* pp = static_cast<ParserState*>(parm);
         yyassert(pp, (yyvsp[0].arg)->isFloat(), "Invalid float initializer");
@@ -2156,11 +2209,11 @@ yyreduce:
           "Duplicate symbol");
         delete (yyvsp[-2].argVec); free((yyvsp[-3].sValue));
       }
-#line 2160 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2213 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 41:
-#line 803 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 856 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState* pp = static_cast<ParserState*>(parm);
         yyassert(pp, (yyvsp[0].arg)->isBool(), "Invalid bool initializer");
@@ -2169,11 +2222,11 @@ yyreduce:
           "Duplicate symbol");
         delete (yyvsp[-2].argVec); free((yyvsp[-3].sValue));
       }
-#line 2173 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2226 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 42:
-#line 812 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 865 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState* pp = static_cast<ParserState*>(parm);
         yyassert(pp, (yyvsp[0].arg)->isSet(), "Invalid set initializer");
@@ -2185,11 +2238,11 @@ yyreduce:
         delete set;
         delete (yyvsp[-2].argVec); free((yyvsp[-3].sValue));
       }
-#line 2189 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2242 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 43:
-#line 825 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 878 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState* pp = static_cast<ParserState*>(parm);
         yyassert(pp, (yyvsp[-10].iValue)==1, "Arrays must start at 1");
@@ -2258,11 +2311,11 @@ yyreduce:
         }
         delete (yyvsp[-1].argVec); free((yyvsp[-2].sValue));
       }
-#line 2262 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2315 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 44:
-#line 895 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 948 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState* pp = static_cast<ParserState*>(parm);
         bool print = (yyvsp[-1].argVec) != NULL && (yyvsp[-1].argVec)->hasCall("output_array");
@@ -2327,11 +2380,11 @@ yyreduce:
         }
         delete (yyvsp[-1].argVec); free((yyvsp[-2].sValue));
       }
-#line 2331 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2384 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 45:
-#line 962 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1015 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState* pp = static_cast<ParserState*>(parm);
         yyassert(pp, (yyvsp[-10].iValue)==1, "Arrays must start at 1");
@@ -2400,11 +2453,11 @@ yyreduce:
         if ((yyvsp[-4].oPFloat)()) delete (yyvsp[-4].oPFloat).some();
         delete (yyvsp[-1].argVec); free((yyvsp[-2].sValue));
       }
-#line 2404 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2457 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 46:
-#line 1032 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1085 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState* pp = static_cast<ParserState*>(parm);
         bool print = (yyvsp[-1].argVec) != NULL && (yyvsp[-1].argVec)->hasCall("output_array");
@@ -2471,11 +2524,11 @@ yyreduce:
         }
         delete (yyvsp[-1].argVec); free((yyvsp[-2].sValue));
       }
-#line 2475 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2528 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 47:
-#line 1100 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1153 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState* pp = static_cast<ParserState*>(parm);
         yyassert(pp, (yyvsp[-12].iValue)==1, "Arrays must start at 1");
@@ -2495,11 +2548,11 @@ yyreduce:
         free((yyvsp[-5].sValue));
         delete (yyvsp[-4].argVec);
       }
-#line 2499 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2552 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 48:
-#line 1121 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1174 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState* pp = static_cast<ParserState*>(parm);
         yyassert(pp, (yyvsp[-12].iValue)==1, "Arrays must start at 1");
@@ -2518,11 +2571,11 @@ yyreduce:
         free((yyvsp[-5].sValue));
         delete (yyvsp[-4].argVec);
       }
-#line 2522 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2575 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 49:
-#line 1141 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1194 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState* pp = static_cast<ParserState*>(parm);
         yyassert(pp, (yyvsp[-12].iValue)==1, "Arrays must start at 1");
@@ -2541,11 +2594,11 @@ yyreduce:
         delete (yyvsp[-1].floatSetValue);
         delete (yyvsp[-4].argVec); free((yyvsp[-5].sValue));
       }
-#line 2545 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2598 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 50:
-#line 1161 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1214 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState* pp = static_cast<ParserState*>(parm);
         yyassert(pp, (yyvsp[-14].iValue)==1, "Arrays must start at 1");
@@ -2565,19 +2618,19 @@ yyreduce:
         delete (yyvsp[-1].setValueList);
         delete (yyvsp[-4].argVec); free((yyvsp[-5].sValue));
       }
-#line 2569 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2622 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 51:
-#line 1183 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1236 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         (yyval.varSpec) = new IntVarSpec((yyvsp[0].iValue),false,false);
       }
-#line 2577 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2630 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 52:
-#line 1187 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1240 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         SymbolEntry e;
         ParserState* pp = static_cast<ParserState*>(parm);
@@ -2592,11 +2645,11 @@ yyreduce:
         }
         free((yyvsp[0].sValue));
       }
-#line 2596 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2649 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 53:
-#line 1202 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1255 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         vector<int> v;
         SymbolEntry e;
@@ -2617,47 +2670,47 @@ yyreduce:
         }
         free((yyvsp[-3].sValue));
       }
-#line 2621 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2674 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 54:
-#line 1225 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1278 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpecVec) = new vector<VarSpec*>(0); }
-#line 2627 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2680 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 55:
-#line 1227 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1280 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpecVec) = (yyvsp[-1].varSpecVec); }
-#line 2633 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2686 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 56:
-#line 1231 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1284 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpecVec) = new vector<VarSpec*>(1); (*(yyval.varSpecVec))[0] = (yyvsp[0].varSpec); }
-#line 2639 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2692 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 57:
-#line 1233 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1286 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpecVec) = (yyvsp[-2].varSpecVec); (yyval.varSpecVec)->push_back((yyvsp[0].varSpec)); }
-#line 2645 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2698 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 60:
-#line 1238 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1291 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpecVec) = (yyvsp[-1].varSpecVec); }
-#line 2651 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2704 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 61:
-#line 1242 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1295 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpec) = new FloatVarSpec((yyvsp[0].dValue),false,false); }
-#line 2657 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2710 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 62:
-#line 1244 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1297 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         SymbolEntry e;
         ParserState* pp = static_cast<ParserState*>(parm);
@@ -2672,11 +2725,11 @@ yyreduce:
         }
         free((yyvsp[0].sValue));
       }
-#line 2676 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2729 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 63:
-#line 1259 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1312 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         SymbolEntry e;
         ParserState* pp = static_cast<ParserState*>(parm);
@@ -2696,47 +2749,47 @@ yyreduce:
         }
         free((yyvsp[-3].sValue));
       }
-#line 2700 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2753 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 64:
-#line 1281 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1334 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpecVec) = new vector<VarSpec*>(0); }
-#line 2706 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2759 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 65:
-#line 1283 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1336 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpecVec) = (yyvsp[-1].varSpecVec); }
-#line 2712 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2765 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 66:
-#line 1287 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1340 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpecVec) = new vector<VarSpec*>(1); (*(yyval.varSpecVec))[0] = (yyvsp[0].varSpec); }
-#line 2718 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2771 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 67:
-#line 1289 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1342 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpecVec) = (yyvsp[-2].varSpecVec); (yyval.varSpecVec)->push_back((yyvsp[0].varSpec)); }
-#line 2724 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2777 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 68:
-#line 1293 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1346 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpecVec) = (yyvsp[-1].varSpecVec); }
-#line 2730 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2783 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 69:
-#line 1297 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1350 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpec) = new BoolVarSpec((yyvsp[0].iValue),false,false); }
-#line 2736 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2789 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 70:
-#line 1299 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1352 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         SymbolEntry e;
         ParserState* pp = static_cast<ParserState*>(parm);
@@ -2751,11 +2804,11 @@ yyreduce:
         }
         free((yyvsp[0].sValue));
       }
-#line 2755 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2808 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 71:
-#line 1314 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1367 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         SymbolEntry e;
         ParserState* pp = static_cast<ParserState*>(parm);
@@ -2775,47 +2828,47 @@ yyreduce:
         }
         free((yyvsp[-3].sValue));
       }
-#line 2779 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2832 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 72:
-#line 1336 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1389 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpecVec) = new vector<VarSpec*>(0); }
-#line 2785 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2838 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 73:
-#line 1338 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1391 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpecVec) = (yyvsp[-1].varSpecVec); }
-#line 2791 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2844 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 74:
-#line 1342 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1395 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpecVec) = new vector<VarSpec*>(1); (*(yyval.varSpecVec))[0] = (yyvsp[0].varSpec); }
-#line 2797 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2850 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 75:
-#line 1344 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1397 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpecVec) = (yyvsp[-2].varSpecVec); (yyval.varSpecVec)->push_back((yyvsp[0].varSpec)); }
-#line 2803 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2856 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 76:
-#line 1346 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1399 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpecVec) = (yyvsp[-1].varSpecVec); }
-#line 2809 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2862 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 77:
-#line 1350 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1403 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpec) = new SetVarSpec((yyvsp[0].setLit),false,false); }
-#line 2815 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2868 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 78:
-#line 1352 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1405 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState* pp = static_cast<ParserState*>(parm);
         SymbolEntry e;
@@ -2830,11 +2883,11 @@ yyreduce:
         }
         free((yyvsp[0].sValue));
       }
-#line 2834 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2887 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 79:
-#line 1367 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1420 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         SymbolEntry e;
         ParserState* pp = static_cast<ParserState*>(parm);
@@ -2854,94 +2907,96 @@ yyreduce:
         }
         free((yyvsp[-3].sValue));
       }
-#line 2858 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2911 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 80:
-#line 1389 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1442 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpecVec) = new vector<VarSpec*>(0); }
-#line 2864 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2917 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 81:
-#line 1391 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1444 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpecVec) = (yyvsp[-1].varSpecVec); }
-#line 2870 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2923 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 82:
-#line 1395 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1448 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpecVec) = new vector<VarSpec*>(1); (*(yyval.varSpecVec))[0] = (yyvsp[0].varSpec); }
-#line 2876 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2929 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 83:
-#line 1397 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1450 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpecVec) = (yyvsp[-2].varSpecVec); (yyval.varSpecVec)->push_back((yyvsp[0].varSpec)); }
-#line 2882 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2935 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 84:
-#line 1400 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1453 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpecVec) = (yyvsp[-1].varSpecVec); }
-#line 2888 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2941 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 85:
-#line 1404 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1457 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.oVarSpecVec) = Option<vector<VarSpec*>* >::none(); }
-#line 2894 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2947 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 86:
-#line 1406 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1459 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.oVarSpecVec) = Option<vector<VarSpec*>* >::some((yyvsp[0].varSpecVec)); }
-#line 2900 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2953 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 87:
-#line 1410 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1463 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.oVarSpecVec) = Option<vector<VarSpec*>* >::none(); }
-#line 2906 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2959 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 88:
-#line 1412 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1465 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.oVarSpecVec) = Option<vector<VarSpec*>* >::some((yyvsp[0].varSpecVec)); }
-#line 2912 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2965 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 89:
-#line 1416 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1469 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.oVarSpecVec) = Option<vector<VarSpec*>* >::none(); }
-#line 2918 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2971 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 90:
-#line 1418 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1471 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.oVarSpecVec) = Option<vector<VarSpec*>* >::some((yyvsp[0].varSpecVec)); }
-#line 2924 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2977 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 91:
-#line 1422 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1475 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.oVarSpecVec) = Option<vector<VarSpec*>* >::none(); }
-#line 2930 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2983 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 92:
-#line 1424 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1477 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.oVarSpecVec) = Option<vector<VarSpec*>* >::some((yyvsp[0].varSpecVec)); }
-#line 2936 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2989 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 93:
-#line 1428 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1481 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState *pp = static_cast<ParserState*>(parm);
         if (!pp->hadError) {
           std::string cid((yyvsp[-4].sValue));
-          if (cid=="int_eq" && (yyvsp[-2].argVec)->a[0]->isIntVar() && (yyvsp[-2].argVec)->a[1]->isIntVar()) {
+          if (pp->stream) {
+            postStream(pp, (yyvsp[-4].sValue), (yyvsp[-2].argVec), (yyvsp[0].argVec));
+          } else if (cid=="int_eq" && (yyvsp[-2].argVec)->a[0]->isIntVar() && (yyvsp[-2].argVec)->a[1]->isIntVar()) {
             int base0 = getBaseIntVar(pp,(yyvsp[-2].argVec)->a[0]->getIntVar());
             int base1 = getBaseIntVar(pp,(yyvsp[-2].argVec)->a[1]->getIntVar());
             if (base0 > base1) {
@@ -3046,11 +3101,11 @@ yyreduce:
         }
         free((yyvsp[-4].sValue));
       }
-#line 3050 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3105 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 94:
-#line 1539 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1594 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState *pp = static_cast<ParserState*>(parm);
         initfg(pp);
@@ -3064,11 +3119,11 @@ yyreduce:
           delete (yyvsp[-1].argVec);
         }
       }
-#line 3068 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3123 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 95:
-#line 1553 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1608 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState *pp = static_cast<ParserState*>(parm);
         initfg(pp);
@@ -3087,37 +3142,37 @@ yyreduce:
           delete (yyvsp[-2].argVec);
         }
       }
-#line 3091 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3146 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 96:
-#line 1578 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1633 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.oSet) = Option<AST::SetLit* >::none(); }
-#line 3097 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3152 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 97:
-#line 1580 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1635 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.oSet) = Option<AST::SetLit* >::some(new AST::SetLit(*(yyvsp[-1].setValue))); }
-#line 3103 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3158 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 98:
-#line 1582 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1637 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         (yyval.oSet) = Option<AST::SetLit* >::some(new AST::SetLit((yyvsp[-2].iValue), (yyvsp[0].iValue)));
       }
-#line 3111 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3166 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 99:
-#line 1588 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1643 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.oSet) = Option<AST::SetLit* >::none(); }
-#line 3117 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3172 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 100:
-#line 1590 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1645 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { bool haveTrue = false;
         bool haveFalse = false;
         for (int i=(yyvsp[-2].setValue)->size(); i--;) {
@@ -3128,192 +3183,192 @@ yyreduce:
         (yyval.oSet) = Option<AST::SetLit* >::some(
           new AST::SetLit(!haveFalse,haveTrue));
       }
-#line 3132 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3187 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 101:
-#line 1603 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1658 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.oPFloat) = Option<std::pair<double,double>* >::none(); }
-#line 3138 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3193 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 102:
-#line 1605 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1660 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { std::pair<double,double>* dom = new std::pair<double,double>((yyvsp[-2].dValue),(yyvsp[0].dValue));
         (yyval.oPFloat) = Option<std::pair<double,double>* >::some(dom); }
-#line 3145 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3200 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 103:
-#line 1614 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1669 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.setLit) = new AST::SetLit(*(yyvsp[-1].setValue)); }
-#line 3151 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3206 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 104:
-#line 1616 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1671 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.setLit) = new AST::SetLit((yyvsp[-2].iValue), (yyvsp[0].iValue)); }
-#line 3157 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3212 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 105:
-#line 1622 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1677 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.setValue) = new vector<int>(0); }
-#line 3163 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3218 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 106:
-#line 1624 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1679 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.setValue) = (yyvsp[-1].setValue); }
-#line 3169 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3224 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 107:
-#line 1628 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1683 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.setValue) = new vector<int>(1); (*(yyval.setValue))[0] = (yyvsp[0].iValue); }
-#line 3175 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3230 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 108:
-#line 1630 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1685 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.setValue) = (yyvsp[-2].setValue); (yyval.setValue)->push_back((yyvsp[0].iValue)); }
-#line 3181 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3236 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 109:
-#line 1634 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1689 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.setValue) = new vector<int>(0); }
-#line 3187 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3242 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 110:
-#line 1636 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1691 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.setValue) = (yyvsp[-1].setValue); }
-#line 3193 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3248 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 111:
-#line 1640 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1695 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.setValue) = new vector<int>(1); (*(yyval.setValue))[0] = (yyvsp[0].iValue); }
-#line 3199 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3254 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 112:
-#line 1642 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1697 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.setValue) = (yyvsp[-2].setValue); (yyval.setValue)->push_back((yyvsp[0].iValue)); }
-#line 3205 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3260 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 113:
-#line 1646 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1701 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.floatSetValue) = new vector<double>(0); }
-#line 3211 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3266 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 114:
-#line 1648 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1703 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.floatSetValue) = (yyvsp[-1].floatSetValue); }
-#line 3217 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3272 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 115:
-#line 1652 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1707 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.floatSetValue) = new vector<double>(1); (*(yyval.floatSetValue))[0] = (yyvsp[0].dValue); }
-#line 3223 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3278 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 116:
-#line 1654 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1709 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.floatSetValue) = (yyvsp[-2].floatSetValue); (yyval.floatSetValue)->push_back((yyvsp[0].dValue)); }
-#line 3229 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3284 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 117:
-#line 1658 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1713 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.setValueList) = new vector<AST::SetLit>(0); }
-#line 3235 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3290 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 118:
-#line 1660 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1715 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.setValueList) = (yyvsp[-1].setValueList); }
-#line 3241 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3296 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 119:
-#line 1664 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1719 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.setValueList) = new vector<AST::SetLit>(1); (*(yyval.setValueList))[0] = *(yyvsp[0].setLit); delete (yyvsp[0].setLit); }
-#line 3247 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3302 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 120:
-#line 1666 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1721 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.setValueList) = (yyvsp[-2].setValueList); (yyval.setValueList)->push_back(*(yyvsp[0].setLit)); delete (yyvsp[0].setLit); }
-#line 3253 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3308 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 121:
-#line 1674 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1729 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.argVec) = new AST::Array((yyvsp[0].arg)); }
-#line 3259 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3314 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 122:
-#line 1676 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1731 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.argVec) = (yyvsp[-2].argVec); (yyval.argVec)->append((yyvsp[0].arg)); }
-#line 3265 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3320 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 123:
-#line 1680 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1735 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.arg) = (yyvsp[0].arg); }
-#line 3271 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3326 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 124:
-#line 1682 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1737 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.arg) = (yyvsp[-1].argVec); }
-#line 3277 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3332 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 125:
-#line 1686 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1741 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.oArg) = Option<AST::Node*>::none(); }
-#line 3283 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3338 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 126:
-#line 1688 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1743 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.oArg) = Option<AST::Node*>::some((yyvsp[0].arg)); }
-#line 3289 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3344 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 127:
-#line 1692 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1747 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.arg) = new AST::BoolLit((yyvsp[0].iValue)); }
-#line 3295 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3350 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 128:
-#line 1694 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1749 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.arg) = new AST::IntLit((yyvsp[0].iValue)); }
-#line 3301 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3356 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 129:
-#line 1696 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1751 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.arg) = new AST::FloatLit((yyvsp[0].dValue)); }
-#line 3307 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3362 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 130:
-#line 1698 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1753 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.arg) = (yyvsp[0].setLit); }
-#line 3313 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3368 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 131:
-#line 1700 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1755 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState* pp = static_cast<ParserState*>(parm);
         SymbolEntry e;
@@ -3409,11 +3464,11 @@ yyreduce:
         }
         free((yyvsp[0].sValue));
       }
-#line 3413 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3468 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 132:
-#line 1796 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1851 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState* pp = static_cast<ParserState*>(parm);
         int i = -1;
@@ -3425,35 +3480,35 @@ yyreduce:
         delete (yyvsp[-1].arg);
         free((yyvsp[-3].sValue));
       }
-#line 3429 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3484 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 133:
-#line 1810 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1865 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.argVec) = new AST::Array(0); }
-#line 3435 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3490 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 134:
-#line 1812 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1867 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.argVec) = (yyvsp[-1].argVec); }
-#line 3441 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3496 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 135:
-#line 1816 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1871 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.argVec) = new AST::Array((yyvsp[0].arg)); }
-#line 3447 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3502 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 136:
-#line 1818 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1873 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.argVec) = (yyvsp[-2].argVec); (yyval.argVec)->append((yyvsp[0].arg)); }
-#line 3453 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3508 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 137:
-#line 1826 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1881 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState *pp = static_cast<ParserState*>(parm);
         SymbolEntry e;
@@ -3487,33 +3542,33 @@ yyreduce:
         }
         free((yyvsp[0].sValue));
       }
-#line 3491 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3546 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 138:
-#line 1860 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1915 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState *pp = static_cast<ParserState*>(parm);
         pp->intvars.push_back(varspec("OBJ_CONST_INTRODUCED",
           new IntVarSpec(0,true,false)));
         (yyval.iValue) = pp->intvars.size()-1;
       }
-#line 3502 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3557 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 139:
-#line 1867 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1922 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState *pp = static_cast<ParserState*>(parm);
         pp->intvars.push_back(varspec("OBJ_CONST_INTRODUCED",
           new IntVarSpec(0,true,false)));
         (yyval.iValue) = pp->intvars.size()-1;
       }
-#line 3513 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3568 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 140:
-#line 1874 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1929 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         SymbolEntry e;
         ParserState *pp = static_cast<ParserState*>(parm);
@@ -3537,103 +3592,103 @@ yyreduce:
         }
         free((yyvsp[-3].sValue));
       }
-#line 3541 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3596 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 143:
-#line 1908 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1963 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.argVec) = NULL; }
-#line 3547 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3602 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 144:
-#line 1910 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1965 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.argVec) = (yyvsp[0].argVec); }
-#line 3553 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3608 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 145:
-#line 1914 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1969 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.argVec) = new AST::Array((yyvsp[0].arg)); }
-#line 3559 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3614 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 146:
-#line 1916 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1971 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.argVec) = (yyvsp[-2].argVec); (yyval.argVec)->append((yyvsp[0].arg)); }
-#line 3565 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3620 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 147:
-#line 1920 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1975 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         (yyval.arg) = new AST::Call((yyvsp[-3].sValue), AST::extractSingleton((yyvsp[-1].arg))); free((yyvsp[-3].sValue));
       }
-#line 3573 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3628 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 148:
-#line 1924 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1979 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.arg) = (yyvsp[0].arg); }
-#line 3579 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3634 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 149:
-#line 1928 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1983 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.arg) = new AST::Array((yyvsp[0].arg)); }
-#line 3585 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3640 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 150:
-#line 1930 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1985 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.arg) = (yyvsp[-2].arg); (yyval.arg)->append((yyvsp[0].arg)); }
-#line 3591 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3646 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 151:
-#line 1934 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1989 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.arg) = (yyvsp[0].arg); }
-#line 3597 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3652 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 152:
-#line 1936 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1991 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.arg) = new AST::Array(); }
-#line 3603 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3658 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 153:
-#line 1938 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1993 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.arg) = (yyvsp[-2].arg); }
-#line 3609 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3664 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 156:
-#line 1944 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1999 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.arg) = new AST::BoolLit((yyvsp[0].iValue)); }
-#line 3615 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3670 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 157:
-#line 1946 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 2001 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.arg) = new AST::IntLit((yyvsp[0].iValue)); }
-#line 3621 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3676 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 158:
-#line 1948 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 2003 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.arg) = new AST::FloatLit((yyvsp[0].dValue)); }
-#line 3627 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3682 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 159:
-#line 1950 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 2005 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.arg) = (yyvsp[0].setLit); }
-#line 3633 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3688 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 160:
-#line 1952 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 2007 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState* pp = static_cast<ParserState*>(parm);
         SymbolEntry e;
@@ -3739,11 +3794,11 @@ yyreduce:
           (yyval.arg) = getVarRefArg(pp,(yyvsp[0].sValue),true);
         free((yyvsp[0].sValue));
       }
-#line 3743 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3798 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 161:
-#line 2058 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 2113 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState* pp = static_cast<ParserState*>(parm);
         int i = -1;
@@ -3754,20 +3809,20 @@ yyreduce:
           (yyval.arg) = new AST::IntLit(0); // keep things consistent
         free((yyvsp[-3].sValue));
       }
-#line 3758 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3813 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 162:
-#line 2069 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 2124 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         (yyval.arg) = new AST::String((yyvsp[0].sValue));
         free((yyvsp[0].sValue));
       }
-#line 3767 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3822 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
 
-#line 3771 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3826 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
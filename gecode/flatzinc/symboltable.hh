@@ -35,58 +35,117 @@
 #define __GECODE_FLATZINC_SYMBOLTABLE_HH__
 
 #include <vector>
-
-#ifdef GECODE_HAS_UNORDERED_MAP
-#include <unordered_map>
-#elif defined(GECODE_HAS_GNU_HASH_MAP)
-#include <ext/hash_map>
-#else
-#include <map>
-#endif
+#include <string>
 
 namespace Gecode { namespace FlatZinc {
 
-  /// Symbol table mapping identifiers (strings) to values
+  /**
+   * \brief Symbol table mapping identifiers (strings) to values
+   *
+   * The table uses open addressing with linear probing. Each identifier
+   * is stored once in the table, and the table is grown when it is
+   * half full.
+   */
   template<class Val>
   class SymbolTable {
   private:
-#ifdef GECODE_HAS_UNORDERED_MAP
-    typedef std::unordered_map<std::string,Val> mymap;
-#elif defined(GECODE_HAS_GNU_HASH_MAP)
-    class hashString {
+    /// Entry in the table
+    class Entry {
     public:
-      size_t operator ()(const std::string& x) const {
-        return __gnu_cxx::hash<const char*>()(x.c_str());
-      }
+      /// The identifier
+      std::string key;
+      /// The value
+      Val val;
+      /// Whether the entry is used
+      bool used;
+      /// Initialize as unused entry
+      Entry(void);
     };
-    typedef __gnu_cxx::hash_map<std::string,Val,hashString> mymap;
-#else
-    typedef std::map<std::string,Val> mymap;
-#endif
-    mymap m;
+    /// The entries (number is a power of two)
+    std::vector<Entry> t;
+    /// Number of used entries
+    unsigned int n;
+    /// Return hash value for \a key
+    static unsigned int hashString(const std::string& key);
+    /// Return index of entry for \a key (might be unused)
+    unsigned int find(const std::string& key) const;
+    /// Double the size of the table
+    void grow(void);
   public:
+    /// Initialize empty table
+    SymbolTable(void);
     /// Insert \a val with \a key
     bool put(const std::string& key, const Val& val);
     /// Return whether \a key exists, and set \a val if it does exist
     bool get(const std::string& key, Val& val) const;
   };
 
+  template<class Val>
+  forceinline
+  SymbolTable<Val>::Entry::Entry(void) : used(false) {}
+
+  template<class Val>
+  forceinline unsigned int
+  SymbolTable<Val>::hashString(const std::string& key) {
+    // FNV-1a
+    unsigned int h = 2166136261U;
+    for (std::string::size_type i=0; i<key.size(); i++) {
+      h ^= static_cast<unsigned char>(key[i]);
+      h *= 16777619U;
+    }
+    return h;
+  }
+
+  template<class Val>
+  forceinline unsigned int
+  SymbolTable<Val>::find(const std::string& key) const {
+    unsigned int m = static_cast<unsigned int>(t.size()) - 1U;
+    unsigned int i = hashString(key) & m;
+    while (t[i].used && (t[i].key != key))
+      i = (i+1) & m;
+    return i;
+  }
+
+  template<class Val>
+  void
+  SymbolTable<Val>::grow(void) {
+    std::vector<Entry> o(2*t.size());
+    o.swap(t);
+    for (unsigned int j=0; j<o.size(); j++)
+      if (o[j].used) {
+        Entry& e = t[find(o[j].key)];
+        e.key.swap(o[j].key);
+        e.val = o[j].val;
+        e.used = true;
+      }
+  }
+
+  template<class Val>
+  SymbolTable<Val>::SymbolTable(void) : t(1024), n(0) {}
+
   template<class Val>
   bool
   SymbolTable<Val>::put(const std::string& key, const Val& val) {
-    typename mymap::const_iterator i = m.find(key);
-    bool fresh = (i == m.end());
-    m[key] = val;
-    return fresh;
+    unsigned int i = find(key);
+    if (t[i].used) {
+      t[i].val = val;
+      return false;
+    }
+    if (2*(n+1) > t.size()) {
+      grow(); i = find(key);
+    }
+    t[i].key = key; t[i].val = val; t[i].used = true;
+    n++;
+    return true;
   }
 
   template<class Val>
   bool
   SymbolTable<Val>::get(const std::string& key, Val& val) const {
-    typename mymap::const_iterator i = m.find(key);
-    if (i == m.end())
+    unsigned int i = find(key);
+    if (!t[i].used)
       return false;
-    val = i->second;
+    val = t[i].val;
     return true;
   }
 
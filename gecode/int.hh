@@ -1393,6 +1393,28 @@ namespace Gecode {
   GECODE_INT_EXPORT void
   clause(Home home, BoolOpType o, const BoolVarArgs& x, const BoolVarArgs& y,
          int n, IntPropLevel ipl=IPL_DEF);
+  /** \brief Post domain consistent propagator for conjunction of clauses \a c over \a x
+   *
+   * The clauses are given in DIMACS format: a positive integer
+   * \f$i\f$ denotes the literal \f$x_{i-1}\f$, a negative integer
+   * \f$-i\f$ denotes the literal \f$\neg x_{i-1}\f$, and each clause
+   * is terminated by 0 (the terminating 0 of the last clause can be
+   * omitted). All clauses are propagated by a single propagator using
+   * watched literals, which is considerably more efficient than
+   * posting a propagator per clause for many clauses.
+   *
+   * If \a ipl is IPL_ADVANCED, the propagator learns clauses from
+   * the failures it detects. The learned clauses are shared by all
+   * copies of the propagator and hence also benefit parallel search.
+   * Note that learning only takes the clauses in \a c into account.
+   *
+   * Throws an exception of type Int::OutOfLimits, if an integer in
+   * \a c is less than \f$-|x|\f$ or larger than \f$|x|\f$.
+   * \ingroup TaskModelIntRelBool
+   */
+  GECODE_INT_EXPORT void
+  clause(Home home, const BoolVarArgs& x, const IntArgs& c,
+         IntPropLevel ipl=IPL_DEF);
   /** \brief Post propagator for if-then-else constraint
    *
    * Posts propagator for \f$ z = b ? x : y \f$
@@ -2252,6 +2274,10 @@ namespace Gecode {
       Range* range;
       /// Pointer to all support data
       BitSetData* support;
+      /// File data for tuples and supports (nullptr if not loaded from file)
+      char* mapped;
+      /// Size of file data
+      std::size_t n_mapped;
 
       /// Return newly added tuple
       Tuple add(void);
@@ -2312,6 +2338,18 @@ namespace Gecode {
     /// Initialize with DFA \a dfa for arity \a a
     GECODE_INT_EXPORT
     TupleSet(int a, const DFA& dfa);
+    /**
+     * \brief Initialize from file \a fn written by TupleSet::save
+     *
+     * The tuple set is finalized. Tuples and supports are not copied:
+     * if supported by the operating system, the file is mapped into
+     * memory and hence shared among all processes loading it.
+     *
+     * Throws an exception of type Int::TupleSetFileError if the file
+     * cannot be read or has not been written by a compatible platform.
+     */
+    GECODE_INT_EXPORT
+    explicit TupleSet(const char* fn);
     /// Test whether tuple set has been initialized
     operator bool(void) const;
     /// Test whether tuple set is equal to \a t
@@ -2328,6 +2366,15 @@ namespace Gecode {
     bool finalized(void) const;
     /// Finalize tuple set
     void finalize(void);
+    /**
+     * \brief Save finalized tuple set to file \a fn
+     *
+     * The file can only be loaded on platforms with the same byte
+     * order and word size. Throws an exception of type
+     * Int::TupleSetFileError if the file cannot be written.
+     */
+    GECODE_INT_EXPORT
+    void save(const char* fn) const;
     //@}
 
     /// \name Tuple access
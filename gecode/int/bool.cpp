@@ -987,6 +987,19 @@ namespace Gecode {
     }
   }
 
+  void
+  clause(Home home, const BoolVarArgs& x, const IntArgs& c,
+         IntPropLevel ipl) {
+    using namespace Int;
+    for (int i=0; i<c.size(); i++)
+      if ((c[i] < -x.size()) || (c[i] > x.size()))
+        throw OutOfLimits("Int::clause");
+    GECODE_POST;
+    ViewArray<BoolView> xv(home,x);
+    GECODE_ES_FAIL(Bool::ClauseDB::post(home,xv,c,
+                                        ba(ipl) == IPL_ADVANCED));
+  }
+
   void
   ite(Home home, BoolVar b, IntVar x, IntVar y, IntVar z,
       IntPropLevel ipl) {
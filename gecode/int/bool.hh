@@ -482,6 +482,188 @@ namespace Gecode { namespace Int { namespace Bool {
   };
 
 
+  /**
+   * \brief Boolean clause database propagator
+   *
+   * Propagates a conjunction of clauses with two watched literals per
+   * clause. A literal \f$2i\f$ denotes \f$x_i\f$ and a literal
+   * \f$2i+1\f$ denotes \f$\neg x_i\f$. The literals of all clauses
+   * are stored in a single array that is shared by all copies of the
+   * propagator, only the watches are copied when cloning. Clauses
+   * that are satisfied by a watched literal are not copied.
+   *
+   * The propagator uses a single advisor per view rather than one
+   * propagator per clause.
+   *
+   * If learning is enabled, each failure detected by the propagator
+   * is analyzed by resolution on the clauses that implied the failing
+   * literals (up to the first unique implication point of the current
+   * propagation). As the learned clauses only depend on the clauses
+   * of the propagator, they are valid for all copies and are stored
+   * in a store shared by all copies. Copies import new learned clauses
+   * when they propagate and drop the watches of learned clauses with
+   * low activity.
+   *
+   * Requires \code #include <gecode/int/bool.hh> \endcode
+   * \ingroup FuncIntProp
+   */
+  class ClauseDB : public Propagator {
+  protected:
+    /// %Advisor remembering the index of its view
+    class Idx : public Advisor {
+    public:
+      /// Index of the view
+      int i;
+      /// Create advisor for view with index \a i
+      Idx(Space& home, Propagator& p, Council<Idx>& c, int i);
+      /// Clone advisor \a a
+      Idx(Space& home, Idx& a);
+    };
+    /// Learned clauses shared by all copies of the propagator
+    class Learned : public SharedHandle {
+    protected:
+      /// The actual store
+      class Store : public SharedHandle::Object {
+      public:
+        /// Mutex to synchronize access
+        Support::Mutex m;
+        /// Number of published clauses
+        int n;
+        /// Maximal number of clauses
+        int max_c;
+        /// Number of used literal slots
+        int n_l;
+        /// Maximal number of literal slots
+        int max_l;
+        /// Start of clause \f$k\f$ in \a l (its size followed by its literals)
+        int* s;
+        /// Sizes and literals of all clauses
+        int* l;
+        /// Activity for each clause
+        double* a;
+        /// Increment for activity
+        double inc;
+        /// Initialize for at most \a c clauses and \a l literals
+        Store(int c, int l);
+        /// Delete object
+        virtual ~Store(void);
+      };
+      /// Return object of correct type
+      Store& object(void) const;
+    public:
+      /// Construct as not enabled
+      Learned(void);
+      /// Create store for at most \a c clauses and \a l literals
+      Learned(int c, int l);
+      /// Return the number of published clauses
+      int size(void) const;
+      /**
+       * \brief Return clause \a k
+       *
+       * The first element is the size, the literals follow. As
+       * clauses are never modified once published, \a k must be less
+       * than a value returned by size().
+       */
+      const int* operator [](int k) const;
+      /**
+       * \brief Add clause \a c with \a n literals
+       *
+       * Also increases the activity of the \a n_u clauses \a u that
+       * have been used to derive \a c. The clause is ignored if the
+       * store is full.
+       */
+      void add(const int* c, int n, const int* u, int n_u);
+      /// Store activities of the \a n clauses \a k in \a a
+      void activity(const int* k, int n, double* a) const;
+    };
+    /// The views
+    ViewArray<BoolView> x;
+    /// Literals of all clauses
+    SharedArray<int> l;
+    /// Clause \f$j\f$ has the literals from \f$s_j\f$ to \f$s_{j+1}-1\f$
+    SharedArray<int> s;
+    /// Learned clauses (only if learning is enabled)
+    Learned ls;
+    /// Number of clauses that are watched
+    int n_c;
+    /// Number of clauses for which watches can be stored
+    int n_w;
+    /// Clause index for each watched clause (learned clauses follow the original clauses)
+    int* cid;
+    /// Watched literals for watched clause \f$j\f$ are \f$w_{2j}\f$ and \f$w_{2j+1}\f$ (or -1 if dropped)
+    int* w;
+    /// Next watch with the same literal (or -1)
+    int* nw;
+    /// First watch for each literal (or -1)
+    int* hw;
+    /// Indices of views that are assigned but not yet propagated
+    int* q;
+    /// Number of indices in \a q
+    int n_q;
+    /// Number of learned clauses imported
+    int n_i;
+    /// Number of watched learned clauses
+    int n_lw;
+    /// Clause that implied the value of a view (or -1, only if learning)
+    int* rsn;
+    /// Indices of views in order of assignment (only if learning)
+    int* tr;
+    /// Position of a view in the trail (only if learning)
+    int* tp;
+    /// Number of views on the trail
+    int n_tr;
+    /// The advisor council
+    Council<Idx> c;
+    /// Allocate all per-view arrays and watches for \a n_w clauses
+    void alloc(Space& home);
+    /// Watch clause \a j by literals \a l0 and \a l1
+    void watch(Space& home, int j, int l0, int l1);
+    /// Return literals \a lc and their number \a n_lc of clause \a j
+    void clause(int j, const int*& lc, int& n_lc) const;
+    /// Import learned clauses
+    ExecStatus import(Space& home);
+    /// Drop the watches of the less active half of the learned clauses
+    void reduce(void);
+    /// Learn from failure of clause \a j for propagation starting at \a rs on the trail
+    void analyze(int j, int rs);
+    /// Constructor for posting
+    ClauseDB(Home home, ViewArray<BoolView>& x,
+             SharedArray<int>& l, SharedArray<int>& s, bool learn);
+    /// Constructor for cloning \a p
+    ClauseDB(Space& home, ClauseDB& p);
+  public:
+    /// Copy propagator during cloning
+    GECODE_INT_EXPORT
+    virtual Actor* copy(Space& home);
+    /// Give advice to propagator
+    GECODE_INT_EXPORT
+    virtual ExecStatus advise(Space& home, Advisor& a, const Delta& d);
+    /// Cost function (defined as low linear in the views to propagate)
+    GECODE_INT_EXPORT
+    virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+    /// Schedule function
+    GECODE_INT_EXPORT
+    virtual void reschedule(Space& home);
+    /// Perform propagation
+    GECODE_INT_EXPORT
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /**
+     * \brief Post propagator for the clauses \a c over \a x
+     *
+     * The clauses are given in DIMACS format: a literal \f$i>0\f$
+     * denotes \f$x_{i-1}\f$, a literal \f$-i<0\f$ denotes
+     * \f$\neg x_{i-1}\f$, and each clause is terminated by 0. If
+     * \a learn is true, clauses are learned from failures.
+     */
+    GECODE_INT_EXPORT
+    static ExecStatus post(Home home, ViewArray<BoolView>& x,
+                           const IntArgs& c, bool learn=false);
+    /// Delete propagator and return its size
+    GECODE_INT_EXPORT
+    virtual size_t dispose(Space& home);
+  };
+
+
   /**
    * \brief Boolean clause propagator (disjunctive)
    *
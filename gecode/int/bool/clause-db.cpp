@@ -0,0 +1,547 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/int/bool.hh>
+
+namespace Gecode { namespace Int { namespace Bool {
+
+  /*
+   * Clause database propagator
+   *
+   */
+
+  forceinline
+  ClauseDB::Idx::Idx(Space& home, Propagator& p, Council<Idx>& c, int i0)
+    : Advisor(home,p,c), i(i0) {}
+
+  forceinline
+  ClauseDB::Idx::Idx(Space& home, Idx& a)
+    : Advisor(home,a), i(a.i) {}
+
+  /// Test whether literal \a l is false
+  forceinline bool
+  zero(const ViewArray<BoolView>& x, int l) {
+    return ((l & 1) == 0) ? x[l >> 1].zero() : x[l >> 1].one();
+  }
+
+  /// Test whether literal \a l is true
+  forceinline bool
+  one(const ViewArray<BoolView>& x, int l) {
+    return ((l & 1) == 0) ? x[l >> 1].one() : x[l >> 1].zero();
+  }
+
+  /*
+   * Store for learned clauses
+   *
+   */
+
+  ClauseDB::Learned::Store::Store(int c, int l0)
+    : n(0), max_c(c), n_l(0), max_l(l0),
+      s(heap.alloc<int>(c)), l(heap.alloc<int>(l0)),
+      a(heap.alloc<double>(c)), inc(1.0) {}
+
+  ClauseDB::Learned::Store::~Store(void) {
+    heap.rfree(s);
+    heap.rfree(l);
+    heap.rfree(a);
+  }
+
+  forceinline ClauseDB::Learned::Store&
+  ClauseDB::Learned::object(void) const {
+    return static_cast<Store&>(*SharedHandle::object());
+  }
+
+  forceinline
+  ClauseDB::Learned::Learned(void) {}
+
+  forceinline
+  ClauseDB::Learned::Learned(int c, int l)
+    : SharedHandle(new Store(c,l)) {}
+
+  forceinline int
+  ClauseDB::Learned::size(void) const {
+    Store& o = object();
+    o.m.acquire();
+    int n = o.n;
+    o.m.release();
+    return n;
+  }
+
+  forceinline const int*
+  ClauseDB::Learned::operator [](int k) const {
+    const Store& o = object();
+    return o.l + o.s[k];
+  }
+
+  void
+  ClauseDB::Learned::add(const int* c, int n, const int* u, int n_u) {
+    Store& o = object();
+    o.m.acquire();
+    for (int i=0; i<n_u; i++)
+      o.a[u[i]] += o.inc;
+    if ((o.n < o.max_c) && (o.n_l + n + 1 <= o.max_l)) {
+      o.s[o.n] = o.n_l;
+      o.l[o.n_l++] = n;
+      for (int i=0; i<n; i++)
+        o.l[o.n_l++] = c[i];
+      o.a[o.n] = o.inc;
+      // Publish the clause only after it has been written
+      o.n++;
+    }
+    // Decay all activities by increasing the increment
+    o.inc *= 1.0 / 0.999;
+    if (o.inc > Kernel::Config::rescale_limit) {
+      for (int i=0; i<o.n; i++)
+        o.a[i] *= Kernel::Config::rescale;
+      o.inc *= Kernel::Config::rescale;
+    }
+    o.m.release();
+  }
+
+  void
+  ClauseDB::Learned::activity(const int* k, int n, double* a) const {
+    Store& o = object();
+    o.m.acquire();
+    for (int i=0; i<n; i++)
+      a[i] = o.a[k[i]];
+    o.m.release();
+  }
+
+
+  /*
+   * Clause database propagator
+   *
+   */
+
+  forceinline void
+  ClauseDB::alloc(Space& home) {
+    assert(n_w > 0);
+    int n = x.size();
+    cid = home.alloc<int>(5*n_w);
+    w   = cid + n_w;
+    nw  = w + 2*n_w;
+    hw  = home.alloc<int>(ls ? 6*n : 3*n);
+    q   = hw + 2*n;
+    if (ls) {
+      rsn = q + n;
+      tr  = rsn + n;
+      tp  = tr + n;
+    } else {
+      rsn = tr = tp = NULL;
+    }
+  }
+
+  forceinline void
+  ClauseDB::watch(Space& home, int j, int l0, int l1) {
+    if (n_c == n_w) {
+      int m = 2*n_w;
+      int* b = home.alloc<int>(5*m);
+      Heap::copy<int>(b,cid,n_c);
+      Heap::copy<int>(b+m,w,2*n_c);
+      Heap::copy<int>(b+3*m,nw,2*n_c);
+      home.free<int>(cid,5*n_w);
+      n_w = m; cid = b; w = cid + n_w; nw = w + 2*n_w;
+    }
+    cid[n_c] = j;
+    int e = 2*n_c;
+    w[e] = l0; nw[e] = hw[l0]; hw[l0] = e; e++;
+    w[e] = l1; nw[e] = hw[l1]; hw[l1] = e;
+    n_c++;
+  }
+
+  forceinline void
+  ClauseDB::clause(int j, const int*& lc, int& n_lc) const {
+    int m = s.size()-1;
+    if (j < m) {
+      lc = &l[s[j]]; n_lc = s[j+1]-s[j];
+    } else {
+      const int* k = ls[j-m];
+      lc = k+1; n_lc = k[0];
+    }
+  }
+
+  ClauseDB::ClauseDB(Home home, ViewArray<BoolView>& x0,
+                     SharedArray<int>& l0, SharedArray<int>& s0, bool learn)
+    : Propagator(home), x(x0), l(l0), s(s0),
+      n_c(0), n_w(s.size()-1), n_q(0), n_i(0), n_lw(0), n_tr(0),
+      c(home) {
+    if (learn)
+      ls = Learned(std::min(4*n_w + 10000, 1 << 20),
+                   std::min(16*l.size() + 100000, 1 << 24));
+    home.notice(*this,AP_DISPOSE);
+    int n = x.size();
+    Space& h = home;
+    alloc(h);
+    for (int i=0; i<2*n; i++)
+      hw[i] = -1;
+    // Watch the first two literals of each clause
+    for (int j=0; j<s.size()-1; j++)
+      watch(h,j,l[s[j]],l[s[j]+1]);
+    if (ls)
+      for (int i=0; i<n; i++)
+        rsn[i] = -1;
+    // Only views occurring in some clause are taken into account
+    Region r;
+    bool* o = r.alloc<bool>(n);
+    for (int i=0; i<n; i++)
+      o[i] = false;
+    for (int k=0; k<l.size(); k++)
+      o[l[k] >> 1] = true;
+    for (int i=0; i<n; i++)
+      if (!o[i]) {
+        continue;
+      } else if (x[i].assigned()) {
+        // Views that are already assigned are propagated first
+        q[n_q++] = i;
+        if (ls) {
+          tr[n_tr] = i; tp[i] = n_tr++;
+        }
+      } else {
+        x[i].subscribe(home,*new (home) Idx(home,*this,c,i));
+      }
+    if (n_q > 0)
+      BoolView::schedule(home,*this,ME_BOOL_VAL);
+  }
+
+  ClauseDB::ClauseDB(Space& home, ClauseDB& p)
+    : Propagator(home,p), l(p.l), s(p.s), ls(p.ls),
+      n_c(0), n_w(0), n_q(0), n_i(p.n_i), n_lw(0), n_tr(p.n_tr) {
+    assert(p.n_q == 0);
+    x.update(home,p.x);
+    c.update(home,p.c);
+    int n = x.size();
+    /*
+     * Only the watches are copied, the clauses are shared. A clause
+     * with a true watched literal remains satisfied in all copies, so
+     * its watches are dropped (as are dropped learned clauses).
+     */
+    for (int j=0; j<p.n_c; j++)
+      if ((p.w[2*j] >= 0) && !one(x,p.w[2*j]) && !one(x,p.w[2*j+1]))
+        n_w++;
+    n_w = std::max(n_w,1);
+    alloc(home);
+    for (int i=0; i<2*n; i++)
+      hw[i] = -1;
+    for (int j=0; j<p.n_c; j++)
+      if ((p.w[2*j] >= 0) && !one(x,p.w[2*j]) && !one(x,p.w[2*j+1])) {
+        watch(home,p.cid[j],p.w[2*j],p.w[2*j+1]);
+        if (p.cid[j] >= s.size()-1)
+          n_lw++;
+      }
+    if (ls) {
+      Heap::copy<int>(rsn,p.rsn,n);
+      Heap::copy<int>(tr,p.tr,n_tr);
+      Heap::copy<int>(tp,p.tp,n);
+    }
+  }
+
+  Actor*
+  ClauseDB::copy(Space& home) {
+    return new (home) ClauseDB(home,*this);
+  }
+
+  PropCost
+  ClauseDB::cost(const Space&, const ModEventDelta&) const {
+    return PropCost::linear(PropCost::LO,n_q);
+  }
+
+  void
+  ClauseDB::reschedule(Space& home) {
+    if (n_q > 0)
+      BoolView::schedule(home,*this,ME_BOOL_VAL);
+  }
+
+  ExecStatus
+  ClauseDB::advise(Space& home, Advisor& _a, const Delta&) {
+    Idx& a = static_cast<Idx&>(_a);
+    // Each view is assigned only once, hence q never overflows
+    q[n_q++] = a.i;
+    if (ls) {
+      tr[n_tr] = a.i; tp[a.i] = n_tr++;
+    }
+    return home.ES_NOFIX_DISPOSE(c,a);
+  }
+
+  /// Sort order for positions by increasing activity
+  class ByActivity {
+  public:
+    /// The activities
+    const double* a;
+    /// Initialize with activities \a a0
+    ByActivity(const double* a0) : a(a0) {}
+    /// Compare positions \a i and \a j
+    bool operator ()(int i, int j) const {
+      return a[i] < a[j];
+    }
+  };
+
+  void
+  ClauseDB::reduce(void) {
+    int m = s.size()-1;
+    Region r;
+    // Positions of watched learned clauses and their indices in the store
+    int* p = r.alloc<int>(n_lw);
+    int* k = r.alloc<int>(n_lw);
+    int n = 0;
+    for (int j=0; j<n_c; j++)
+      if ((cid[j] >= m) && (w[2*j] >= 0)) {
+        p[n] = j; k[n] = cid[j]-m; n++;
+      }
+    assert(n == n_lw);
+    double* a = r.alloc<double>(n);
+    ls.activity(k,n,a);
+    int* o = r.alloc<int>(n);
+    for (int i=0; i<n; i++)
+      o[i] = i;
+    ByActivity by(a);
+    Support::quicksort<int,ByActivity>(o,n,by);
+    // Watches are removed from the watch lists during propagation
+    for (int i=0; i<n/2; i++) {
+      int j = p[o[i]];
+      w[2*j] = w[2*j+1] = -1;
+    }
+    n_lw -= n/2;
+  }
+
+  ExecStatus
+  ClauseDB::import(Space& home) {
+    int m = s.size()-1;
+    int n = ls.size();
+    for ( ; n_i < n; n_i++) {
+      const int* lc = ls[n_i];
+      // Find up to two literals that are not false
+      int l0 = -1, l1 = -1;
+      for (int k=1; k<=lc[0]; k++)
+        if (one(x,lc[k])) {
+          goto satisfied;
+        } else if (!zero(x,lc[k])) {
+          if (l0 < 0)
+            l0 = lc[k];
+          else if (l1 < 0)
+            l1 = lc[k];
+        }
+      if (l0 < 0)
+        return ES_FAILED;
+      if (l1 < 0) {
+        rsn[l0 >> 1] = m+n_i;
+        GECODE_ME_CHECK(x[l0 >> 1].eq(home,1 ^ (l0 & 1)));
+      } else {
+        watch(home,m+n_i,l0,l1);
+        n_lw++;
+      }
+    satisfied: ;
+    }
+    if (n_lw > std::max(m/3,1000))
+      reduce();
+    return ES_OK;
+  }
+
+  void
+  ClauseDB::analyze(int j, int rs) {
+    int n = x.size();
+    Region r;
+    // Whether a view has already been considered
+    bool* seen = r.alloc<bool>(n);
+    for (int i=0; i<n; i++)
+      seen[i] = false;
+    // The learned clause
+    int* lc = r.alloc<int>(n);
+    int n_lc = 0;
+    // The learned clauses used for resolution
+    int* u = r.alloc<int>(n+1);
+    int n_u = 0;
+    // Number of views implied during this propagation still to be resolved
+    int p = 0;
+    // View resolved upon (none for the failed clause)
+    int v = -1;
+    int t = n_tr;
+    while (true) {
+      if (j >= s.size()-1)
+        u[n_u++] = j-(s.size()-1);
+      const int* rc; int n_rc;
+      clause(j,rc,n_rc);
+      for (int k=0; k<n_rc; k++) {
+        int i = rc[k] >> 1;
+        if ((i == v) || seen[i])
+          continue;
+        seen[i] = true;
+        if ((tp[i] >= rs) && (rsn[i] >= 0))
+          p++;
+        else
+          lc[n_lc++] = rc[k];
+      }
+      if (p == 0)
+        break;
+      // Find the most recently implied view to be resolved
+      do {
+        v = tr[--t];
+      } while (!seen[v] || (rsn[v] < 0));
+      if (--p == 0) {
+        // The first unique implication point
+        lc[n_lc++] = 2*v + x[v].val();
+        break;
+      }
+      j = rsn[v];
+    }
+    ls.add(lc,n_lc,u,n_u);
+  }
+
+  ExecStatus
+  ClauseDB::propagate(Space& home, const ModEventDelta&) {
+    // Start of the views on the trail that are propagated now
+    int rs = n_tr - n_q;
+    if (ls)
+      GECODE_ES_CHECK(import(home));
+    while (n_q > 0) {
+      int i = q[--n_q];
+      // The literal that has become false
+      int f = 2*i + x[i].val();
+      // Position of the link to the current watch
+      int* p = &hw[f];
+      while (*p >= 0) {
+        int e = *p;
+        if (w[e] < 0) {
+          // Remove watch of dropped learned clause
+          *p = nw[e]; continue;
+        }
+        // The other watched literal
+        int o = w[e ^ 1];
+        if (one(x,o)) {
+          p = &nw[e]; continue;
+        }
+        // Find a literal that is not false and not yet watched
+        const int* lc; int n_lc;
+        clause(cid[e >> 1],lc,n_lc);
+        int k = 0;
+        while ((k < n_lc) && ((lc[k] == o) || (lc[k] == f) || zero(x,lc[k])))
+          k++;
+        if (k < n_lc) {
+          // Move the watch to the new literal
+          w[e] = lc[k];
+          *p = nw[e];
+          nw[e] = hw[lc[k]]; hw[lc[k]] = e;
+        } else if (zero(x,o)) {
+          if (ls)
+            analyze(cid[e >> 1],rs);
+          return ES_FAILED;
+        } else {
+          // The other watched literal must be true
+          if (ls)
+            rsn[o >> 1] = cid[e >> 1];
+          GECODE_ME_CHECK(x[o >> 1].eq(home,1 ^ (o & 1)));
+          p = &nw[e];
+        }
+      }
+    }
+    return c.empty() ? home.ES_SUBSUMED(*this) : ES_FIX;
+  }
+
+  size_t
+  ClauseDB::dispose(Space& home) {
+    home.ignore(*this,AP_DISPOSE);
+    for (Advisors<Idx> as(c); as(); ++as)
+      x[as.advisor().i].cancel(home,as.advisor());
+    c.dispose(home);
+    int n = x.size();
+    home.free<int>(cid,5*n_w);
+    home.free<int>(hw,ls ? 6*n : 3*n);
+    l.~SharedArray<int>();
+    s.~SharedArray<int>();
+    ls.~Learned();
+    (void) Propagator::dispose(home);
+    return sizeof(*this);
+  }
+
+  ExecStatus
+  ClauseDB::post(Home home, ViewArray<BoolView>& x, const IntArgs& c,
+                 bool learn) {
+    int n = x.size();
+    Region r;
+    // Literals (2i for x_i, 2i+1 for !x_i) and clause starts
+    int* l = r.alloc<int>(c.size());
+    int* s = r.alloc<int>(c.size()+2);
+    int n_l = 0, n_s = 0;
+    // Marks for literals occurring in the current clause
+    int* mark = r.alloc<int>(2*n);
+    for (int i=0; i<2*n; i++)
+      mark[i] = -1;
+    // Start of current clause in c
+    int b = 0;
+    // Number of current clause (used for marking)
+    int cl = 0;
+    for (int i=0; i<=c.size(); i++) {
+      if ((i < c.size()) && (c[i] != 0))
+        continue;
+      // The last clause does not need to be terminated by zero
+      if ((i == c.size()) && (b == i))
+        break;
+      int j = n_l;
+      bool sat = false;
+      for (int k=b; k<i; k++) {
+        int lk = (c[k] > 0) ? 2*(c[k]-1) : 2*(-c[k]-1)+1;
+        if ((mark[lk ^ 1] == cl) || one(x,lk)) {
+          // Clause is a tautology or is already satisfied
+          sat = true; break;
+        }
+        if ((mark[lk] != cl) && !zero(x,lk)) {
+          mark[lk] = cl; l[n_l++] = lk;
+        }
+      }
+      if (sat) {
+        n_l = j;
+      } else if (n_l == j) {
+        return ES_FAILED;
+      } else if (n_l == j+1) {
+        GECODE_ME_CHECK(x[l[j] >> 1].eq(home,1 ^ (l[j] & 1)));
+        n_l = j;
+      } else {
+        s[n_s++] = j;
+      }
+      b = i+1; cl++;
+    }
+    if (n_s == 0)
+      return ES_OK;
+    s[n_s++] = n_l;
+    SharedArray<int> sl(n_l);
+    for (int i=0; i<n_l; i++)
+      sl[i] = l[i];
+    SharedArray<int> ss(n_s);
+    for (int i=0; i<n_s; i++)
+      ss[i] = s[i];
+    (void) new (home) ClauseDB(home,x,sl,ss,learn);
+    return ES_OK;
+  }
+
+}}}
+
+// STATISTICS: int-prop
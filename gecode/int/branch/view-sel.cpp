@@ -106,6 +106,32 @@ namespace Gecode { namespace Int { namespace Branch {
         throw UnknownBranching("Int::branch");
       }
     } else {
+      if (ivb.heap()) {
+        // Only merits that change with the domain alone can use a heap
+        switch (ivb.select()) {
+        case IntVarBranch::SEL_MIN_MIN:
+          return new (home) ViewSelMinHeap<MeritMin<IntView>>(home,ivb);
+        case IntVarBranch::SEL_MIN_MAX:
+          return new (home) ViewSelMaxHeap<MeritMin<IntView>>(home,ivb);
+        case IntVarBranch::SEL_MAX_MIN:
+          return new (home) ViewSelMinHeap<MeritMax<IntView>>(home,ivb);
+        case IntVarBranch::SEL_MAX_MAX:
+          return new (home) ViewSelMaxHeap<MeritMax<IntView>>(home,ivb);
+        case IntVarBranch::SEL_SIZE_MIN:
+          return new (home) ViewSelMinHeap<MeritSize<IntView>>(home,ivb);
+        case IntVarBranch::SEL_SIZE_MAX:
+          return new (home) ViewSelMaxHeap<MeritSize<IntView>>(home,ivb);
+        case IntVarBranch::SEL_REGRET_MIN_MIN:
+          return new (home) ViewSelMinHeap<MeritRegretMin<IntView>>(home,ivb);
+        case IntVarBranch::SEL_REGRET_MIN_MAX:
+          return new (home) ViewSelMaxHeap<MeritRegretMin<IntView>>(home,ivb);
+        case IntVarBranch::SEL_REGRET_MAX_MIN:
+          return new (home) ViewSelMinHeap<MeritRegretMax<IntView>>(home,ivb);
+        case IntVarBranch::SEL_REGRET_MAX_MAX:
+          return new (home) ViewSelMaxHeap<MeritRegretMax<IntView>>(home,ivb);
+        default: break;
+        }
+      }
       switch (ivb.select()) {
       case IntVarBranch::SEL_MERIT_MIN:
         return new (home) ViewSelMin<MeritFunction<IntView>>(home,ivb);
@@ -683,10 +683,15 @@ namespace Gecode { namespace Int { namespace Cumulative {
   template<class ManTask>
   ExecStatus overload(Space& home, int c, TaskArray<ManTask>& t);
 
-  /// Perform time-tabling propagation
+  /**
+   * \brief Perform time-tabling propagation
+   *
+   * The profile \a tp is initialized from the tasks \a t (sorted
+   * by decreasing capacity) when time-tabling is performed first.
+   */
   template<class Task, class Cap>
   ExecStatus timetabling(Space& home, Propagator& p, Cap c,
-                         TaskArray<Task>& t);
+                         TaskArray<Task>& t, Profile<Task>& tp);
 
   /// Propagate by edge-finding
   template<class Task>
@@ -704,6 +709,8 @@ namespace Gecode { namespace Int { namespace Cumulative {
     using TaskProp<ManTask,PL>::t;
     /// Resource capacity
     Cap c;
+    /// Profile for time-tabling
+    Profile<ManTask> tp;
     /// Constructor for creation
     ManProp(Home home, Cap c, TaskArray<ManTask>& t);
     /// Constructor for cloning \a p
@@ -731,6 +738,8 @@ namespace Gecode { namespace Int { namespace Cumulative {
     using TaskProp<OptTask,PL>::t;
     /// Resource capacity
     Cap c;
+    /// Profile for time-tabling
+    Profile<OptTask> tp;
     /// Constructor for creation
     OptProp(Home home, Cap c, TaskArray<OptTask>& t);
     /// Constructor for cloning \a p
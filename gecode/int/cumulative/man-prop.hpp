@@ -47,6 +47,7 @@ namespace Gecode { namespace Int { namespace Cumulative {
   ManProp<ManTask,Cap,PL>::ManProp(Space& home, ManProp<ManTask,Cap,PL>& p)
     : TaskProp<ManTask,PL>(home,p) {
     c.update(home,p.c);
+    tp.update(home,p.tp);
   }
 
   template<class ManTask, class Cap, class PL>
@@ -99,7 +100,7 @@ namespace Gecode { namespace Int { namespace Cumulative {
       GECODE_ES_CHECK(edgefinding(home,c.max(),t));
 
     if (PL::basic)
-      GECODE_ES_CHECK(timetabling(home,*this,c,t));
+      GECODE_ES_CHECK(timetabling(home,*this,c,t,tp));
 
     if (Cap::varderived() && c.assigned() && (c.val() == 1)) {
       // Check that tasks do not overload resource
@@ -49,6 +49,7 @@ namespace Gecode { namespace Int { namespace Cumulative {
   OptProp<OptTask,Cap,PL>::OptProp(Space& home, OptProp<OptTask,Cap,PL>& p)
     : TaskProp<OptTask,PL>(home,p) {
     c.update(home,p.c);
+    tp.update(home,p.tp);
   }
 
   template<class OptTask, class Cap, class PL>
@@ -123,7 +124,7 @@ namespace Gecode { namespace Int { namespace Cumulative {
       GECODE_ES_CHECK(overload(home,c.max(),t));
 
     if (PL::basic)
-      GECODE_ES_CHECK(timetabling(home,*this,c,t));
+      GECODE_ES_CHECK(timetabling(home,*this,c,t,tp));
 
     if (PL::advanced) {
       // Partition into mandatory and optional activities
@@ -52,21 +52,25 @@ namespace Gecode { namespace Int { namespace Cumulative {
   // Basic propagation (timetabling)
   template<class Task, class Cap>
   forceinline ExecStatus
-  timetabling(Space& home, Propagator& p, Cap c, TaskArray<Task>& t) {
+  timetabling(Space& home, Propagator& p, Cap c, TaskArray<Task>& t,
+              Profile<Task>& tp) {
     int ccur = c.max();
     int cmax = ccur;
     int cmin = ccur;
 
-    // Sort tasks by decreasing capacity
-    TaskByDecCap<Task> tbdc;
-    Support::quicksort(&t[0], t.size(), tbdc);
+    if (!tp.initialized()) {
+      // Sort tasks by decreasing capacity, the profile keeps the order
+      TaskByDecCap<Task> tbdc;
+      Support::quicksort(&t[0], t.size(), tbdc);
+      tp.init(home,t);
+    }
 
     Region r;
 
     bool assigned;
-    if (Event* e = Event::events(r,t,assigned)) {
+    if (Event* e = tp.events(r,assigned)) {
       // Set of current but not required tasks
-      Support::BitSet<Region> tasks(r,static_cast<unsigned int>(t.size()));
+      Support::BitSet<Region> tasks(r,static_cast<unsigned int>(tp.size()));
 
       // Process events, use ccur as the capacity that is still free
       do {
@@ -75,9 +79,9 @@ namespace Gecode { namespace Int { namespace Cumulative {
 
         // Process events for completion of required part
         for ( ; (e->type() == Event::LRT) && (e->time() == time); e++)
-          if (t[e->idx()].mandatory()) {
+          if (tp[e->idx()].mandatory()) {
             tasks.set(static_cast<unsigned int>(e->idx()));
-            ccur += t[e->idx()].c();
+            ccur += tp[e->idx()].c();
           }
         // Process events for completion of task
         for ( ; (e->type() == Event::LCT) && (e->time() == time); e++)
@@ -87,34 +91,34 @@ namespace Gecode { namespace Int { namespace Cumulative {
           tasks.set(static_cast<unsigned int>(e->idx()));
         // Process events for zero-length task
         for ( ; (e->type() == Event::ZRO) && (e->time() == time); e++) {
-          ccur -= t[e->idx()].c();
+          ccur -= tp[e->idx()].c();
           if (ccur < cmin) cmin=ccur;
           if (ccur < 0)
             return ES_FAILED;
-          ccur += t[e->idx()].c();
+          ccur += tp[e->idx()].c();
         }
 
         // norun start time
         int nrstime = time;
         // Process events for start of required part
         for ( ; (e->type() == Event::ERT) && (e->time() == time); e++)
-          if (t[e->idx()].mandatory()) {
+          if (tp[e->idx()].mandatory()) {
             tasks.clear(static_cast<unsigned int>(e->idx()));
-            ccur -= t[e->idx()].c();
+            ccur -= tp[e->idx()].c();
             if (ccur < cmin) cmin=ccur;
             nrstime = time+1;
             if (ccur < 0)
               return ES_FAILED;
-          } else if (t[e->idx()].optional() && (t[e->idx()].c() > ccur)) {
-            GECODE_ME_CHECK(t[e->idx()].excluded(home));
+          } else if (tp[e->idx()].optional() && (tp[e->idx()].c() > ccur)) {
+            GECODE_ME_CHECK(tp[e->idx()].excluded(home));
           }
 
         // Exploit that tasks are sorted according to capacity
         for (Iter::Values::BitSet<Support::BitSet<Region> > j(tasks);
-             j() && (t[j.val()].c() > ccur); ++j)
+             j() && (tp[j.val()].c() > ccur); ++j)
           // Task j cannot run from zltime to next time - 1
-          if (t[j.val()].mandatory())
-            GECODE_ME_CHECK(t[j.val()].norun(home, nrstime, e->time() - 1));
+          if (tp[j.val()].mandatory())
+            GECODE_ME_CHECK(tp[j.val()].norun(home, nrstime, e->time() - 1));
       } while (e->type() != Event::END);
 
       GECODE_ME_CHECK(c.gq(home,cmax-cmin));
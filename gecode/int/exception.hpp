@@ -146,6 +146,13 @@ namespace Gecode { namespace Int {
     AlreadyFinalized(const char* l);
   };
 
+  /// %Exception: Tuple set file cannot be read or written
+  class GECODE_INT_EXPORT TupleSetFileError : public Exception {
+  public:
+    /// Initialize with location \a l
+    TupleSetFileError(const char* l);
+  };
+
   /// %Exception: Variable in symmetry not branched on
   class GECODE_INT_EXPORT LDSBUnbranchedVariable : public Exception {
   public:
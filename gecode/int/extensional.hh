@@ -242,8 +242,8 @@ namespace Gecode { namespace Int { namespace Extensional {
     IndexType* _index;
     /// Words
     BitSetData* _bits;
-    /// Replace the \a i th word with \a w, decrease \a limit if \a w is zero
-    void replace_and_decrease(IndexType i, BitSetData w);
+    /// Remove all words that are zero (decreases \a limit)
+    void compact(void);
   public:
     /// Initialize bit set for a number of words \a n
     BitSet(Space& home, unsigned int n);
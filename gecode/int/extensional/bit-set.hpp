@@ -128,20 +128,24 @@ namespace Gecode { namespace Int { namespace Extensional {
     GECODE_NEVER;
   }
 
+  /*
+   * The operations that intersect words are performed in two phases:
+   * first all words are updated in a loop without dependencies between
+   * iterations (so that the compiler can vectorize it) while recording
+   * whether some word has become zero. Only then zero words are removed
+   * by compact().
+   */
+
   template<class IndexType>
   forceinline void
-  BitSet<IndexType>::replace_and_decrease(IndexType i, BitSetData w) {
+  BitSet<IndexType>::compact(void) {
     assert(_limit > 0U);
-    BitSetData w_i = _bits[i];
-    if (w != w_i) {
-      _bits[i] = w;
-      if (w.none()) {
-        assert(_bits[i].none());
+    for (IndexType i = _limit; i--; )
+      if (_bits[i].none()) {
         _limit--;
         _bits[i] = _bits[_limit];
         _index[i] = _index[_limit];
       }
-    }
   }
 
   template<class IndexType>
@@ -167,23 +171,20 @@ namespace Gecode { namespace Int { namespace Extensional {
   forceinline void
   BitSet<IndexType>::intersect_with_mask(const BitSetData* mask) {
     assert(_limit > 0U);
+    bool z = false;
     if (sparse) {
-      for (IndexType i = _limit; i--; ) {
-        assert(!_bits[i].none());
-        BitSetData w_i = _bits[i];
-        BitSetData w_a = BitSetData::a(w_i, mask[_index[i]]);
-        replace_and_decrease(i,w_a);
-        assert(i == _limit || !_bits[i].none());
+      for (IndexType i=0; i<_limit; i++) {
+        _bits[i] = BitSetData::a(_bits[i], mask[_index[i]]);
+        z |= _bits[i].none();
       }
     } else { // The same except different _indexing in mask
-      for (IndexType i = _limit; i--; ) {
-        assert(!_bits[i].none());
-        BitSetData w_i = _bits[i];
-        BitSetData w_a = BitSetData::a(w_i, mask[i]);
-        replace_and_decrease(i,w_a);
-        assert(i == _limit || !_bits[i].none());
+      for (IndexType i=0; i<_limit; i++) {
+        _bits[i] = BitSetData::a(_bits[i], mask[i]);
+        z |= _bits[i].none();
       }
     }
+    if (z)
+      compact();
   }
   
   template<class IndexType>
@@ -191,33 +192,44 @@ namespace Gecode { namespace Int { namespace Extensional {
   BitSet<IndexType>::intersect_with_masks(const BitSetData* a,
                                           const BitSetData* b) {
     assert(_limit > 0U);
-    for (IndexType i = _limit; i--; ) {
-      assert(!_bits[i].none());
-      BitSetData w_i = _bits[i];
+    bool z = false;
+    for (IndexType i=0; i<_limit; i++) {
       IndexType offset = _index[i];
       BitSetData w_o = BitSetData::o(a[offset], b[offset]);
-      BitSetData w_a = BitSetData::a(w_i,w_o);
-      replace_and_decrease(i,w_a);
-      assert(i == _limit || !_bits[i].none());
+      _bits[i] = BitSetData::a(_bits[i],w_o);
+      z |= _bits[i].none();
     }
+    if (z)
+      compact();
   }
   
   template<class IndexType>
   forceinline void
   BitSet<IndexType>::nand_with_mask(const BitSetData* b) {
     assert(_limit > 0U);
-    for (IndexType i = _limit; i--; ) {
-      assert(!_bits[i].none());
-      BitSetData w = BitSetData::a(_bits[i],~(b[_index[i]]));
-      replace_and_decrease(i,w);
-      assert(i == _limit || !_bits[i].none());
+    bool z = false;
+    for (IndexType i=0; i<_limit; i++) {
+      _bits[i] = BitSetData::a(_bits[i],~(b[_index[i]]));
+      z |= _bits[i].none();
     }
+    if (z)
+      compact();
   }
 
   template<class IndexType>
   forceinline bool
   BitSet<IndexType>::intersects(const BitSetData* b) const {
-    for (IndexType i=0; i<_limit; i++)
+    IndexType i=0;
+    // Test four words at a time to reduce the number of branches
+    for ( ; i+4 <= _limit; i += 4) {
+      BitSetData w0 = BitSetData::o(BitSetData::a(_bits[i+0],b[_index[i+0]]),
+                                    BitSetData::a(_bits[i+1],b[_index[i+1]]));
+      BitSetData w1 = BitSetData::o(BitSetData::a(_bits[i+2],b[_index[i+2]]),
+                                    BitSetData::a(_bits[i+3],b[_index[i+3]]));
+      if (!BitSetData::o(w0,w1).none())
+        return true;
+    }
+    for ( ; i<_limit; i++)
       if (!BitSetData::a(_bits[i],b[_index[i]]).none())
         return true;
     return false;
@@ -37,6 +37,16 @@
 
 #include <gecode/int.hh>
 #include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#ifdef GECODE_HAS_UNISTD_H
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
 
 namespace Gecode { namespace Int { namespace Extensional {
 
@@ -55,18 +65,6 @@ namespace Gecode { namespace Int { namespace Extensional {
     bool operator ()(const Tuple& a, const Tuple& b);
   };
 
-  /// Tuple comparison by position
-  class PosCompare {
-  private:
-    /// The position of the tuples to compare
-    int p;
-  public:
-    /// Initialize with position \a p
-    PosCompare(int p);
-    /// Comparison of tuples \a a and \a b
-    bool operator ()(const Tuple& a, const Tuple& b);
-  };
-
 
   forceinline
   TupleCompare::TupleCompare(int a) : arity(a) {}
@@ -82,14 +80,261 @@ namespace Gecode { namespace Int { namespace Extensional {
   }
 
 
+  /// Minimal number of tuples for which finalization uses several threads
+  const int par_tuples = 16384;
+
+  /// Job for sorting tuples lexicographically
+  class SortJob : public Support::Job<int> {
+  protected:
+    /// The tuples to sort
+    Tuple* t;
+    /// Number of tuples
+    int n;
+    /// Arity
+    int a;
+  public:
+    /// Initialize for \a n tuples \a t of arity \a a
+    SortJob(Tuple* t, int n, int a);
+    /// Sort tuples
+    virtual int run(int);
+  };
+
+  /// Job for merging two adjacent sorted sequences of tuples
+  class MergeJob : public Support::Job<int> {
+  protected:
+    /// Begin of first sequence
+    Tuple* f;
+    /// Begin of second sequence
+    Tuple* m;
+    /// End of second sequence
+    Tuple* l;
+    /// Arity
+    int a;
+  public:
+    /// Initialize for merging \a f to \a m with \a m to \a l of arity \a a
+    MergeJob(Tuple* f, Tuple* m, Tuple* l, int a);
+    /// Merge tuples
+    virtual int run(int);
+  };
+
+  /// Information about the values for a position
+  class PosInfo {
+  public:
+    /// Number of values
+    unsigned int n_vals;
+    /// Number of ranges
+    unsigned int n_ranges;
+    /// Ranges
+    TupleSet::Range* r;
+  };
+
+  /// Job for computing the ranges of values for a position
+  class RangeJob : public Support::Job<int> {
+  protected:
+    /// Tuple data
+    const int* td;
+    /// Number of tuples
+    int n;
+    /// Arity
+    int a;
+    /// The position
+    int p;
+    /// Where to store the information
+    PosInfo& pi;
+  public:
+    /// Initialize for position \a p of \a n tuples \a td of arity \a a
+    RangeJob(const int* td, int n, int a, int p, PosInfo& pi);
+    /// Compute ranges (allocated from the heap)
+    virtual int run(int);
+  };
+
+  /// Job for computing the supports for a position
+  class SupportJob : public Support::Job<int> {
+  protected:
+    /// Tuple data
+    const int* td;
+    /// Number of tuples
+    int n;
+    /// Arity
+    int a;
+    /// The position
+    int p;
+    /// Number of words per support
+    unsigned int n_words;
+    /// The information about the position
+    const PosInfo& pi;
+  public:
+    /// Initialize for position \a p of \a n tuples \a td of arity \a a
+    SupportJob(const int* td, int n, int a, int p, unsigned int n_words,
+               const PosInfo& pi);
+    /// Initialize supports and set bits for all tuples
+    virtual int run(int);
+  };
+
+  /// Iterator over an array of jobs
+  class Jobs {
+  protected:
+    /// The jobs
+    Support::Job<int>** j;
+    /// Number of jobs
+    int n;
+    /// Current job
+    int i;
+  public:
+    /// Initialize for \a n jobs \a j
+    Jobs(Support::Job<int>** j, int n);
+    /// Test whether there are more jobs
+    bool operator ()(void) const;
+    /// Return next job
+    Support::Job<int>* job(void);
+  };
+
+  /// Run and delete \a n jobs \a j with at most \a m threads
+  void
+  run(Support::Job<int>** j, int n, unsigned int m) {
+    if ((m > 1U) && (n > 1)) {
+      Jobs js(j,n);
+      Support::RunJobs<Jobs,int> rj(js,m);
+      int r;
+      while (rj.run(r)) {}
+    } else {
+      for (int i=0; i<n; i++) {
+        (void) j[i]->run(i);
+        delete j[i];
+      }
+    }
+  }
+
+  /// Sort \a n tuples \a t of arity \a a lexicographically with \a m threads
+  void
+  sort(Tuple* t, int n, int a, unsigned int m) {
+    if (m <= 1U) {
+      TupleCompare tc(a);
+      Support::quicksort(t, n, tc);
+      return;
+    }
+    Region r;
+    int k = static_cast<int>(m);
+    // Boundaries of chunks
+    int* b = r.alloc<int>(k+1);
+    for (int i=0; i<=k; i++)
+      b[i] = static_cast<int>((static_cast<long long int>(n) * i) / k);
+    Support::Job<int>** j = r.alloc<Support::Job<int>*>(k);
+    // Sort each chunk
+    for (int i=0; i<k; i++)
+      j[i] = new SortJob(t+b[i],b[i+1]-b[i],a);
+    run(j,k,m);
+    // Merge adjacent chunks until only one chunk is left
+    for (int w=1; w<k; w <<= 1) {
+      int n_j = 0;
+      for (int i=0; i+w<k; i += 2*w)
+        j[n_j++] = new MergeJob(t+b[i],t+b[i+w],t+b[std::min(i+2*w,k)],a);
+      run(j,n_j,m);
+    }
+  }
+
+
   forceinline
-  PosCompare::PosCompare(int p0) : p(p0) {}
+  SortJob::SortJob(Tuple* t0, int n0, int a0)
+    : t(t0), n(n0), a(a0) {}
+  int
+  SortJob::run(int) {
+    TupleCompare tc(a);
+    Support::quicksort(t, n, tc);
+    return 0;
+  }
 
-  forceinline bool
-  PosCompare::operator ()(const Tuple& a, const Tuple& b) {
-    return a[p] < b[p];
+  forceinline
+  MergeJob::MergeJob(Tuple* f0, Tuple* m0, Tuple* l0, int a0)
+    : f(f0), m(m0), l(l0), a(a0) {}
+  int
+  MergeJob::run(int) {
+    TupleCompare tc(a);
+    std::inplace_merge(f, m, l, tc);
+    return 0;
+  }
+
+  forceinline
+  RangeJob::RangeJob(const int* td0, int n0, int a0, int p0, PosInfo& pi0)
+    : td(td0), n(n0), a(a0), p(p0), pi(pi0) {}
+  int
+  RangeJob::run(int) {
+    // Sort values for position
+    int* v = heap.alloc<int>(n);
+    for (int i=0; i<n; i++)
+      v[i] = td[i*a+p];
+    Support::quicksort(v, n);
+    // Count values and ranges
+    pi.n_vals = pi.n_ranges = 1U;
+    for (int i=1; i<n; i++) {
+      assert(v[i-1] <= v[i]);
+      if (v[i-1]+1 == v[i]) {
+        pi.n_vals++;
+      } else if (v[i-1]+1 < v[i]) {
+        pi.n_vals++; pi.n_ranges++;
+      }
+    }
+    // Compress into non-overlapping ranges
+    TupleSet::Range* r = pi.r = heap.alloc<TupleSet::Range>(pi.n_ranges);
+    unsigned int j=0U;
+    r[0].min=r[0].max=v[0];
+    for (int i=1; i<n; i++)
+      if (r[j].max+1 == v[i]) {
+        r[j].max=v[i];
+      } else if (r[j].max+1 < v[i]) {
+        j++; r[j].min=r[j].max=v[i];
+      } else {
+        assert(r[j].max == v[i]);
+      }
+    assert(j+1U == pi.n_ranges);
+    heap.rfree(v);
+    return 0;
   }
 
+  forceinline
+  SupportJob::SupportJob(const int* td0, int n0, int a0, int p0,
+                         unsigned int n_words0, const PosInfo& pi0)
+    : td(td0), n(n0), a(a0), p(p0), n_words(n_words0), pi(pi0) {}
+  int
+  SupportJob::run(int) {
+    const TupleSet::Range* r = pi.r;
+    TupleSet::BitSetData* s = r[0].s;
+    for (unsigned int i=0U; i<pi.n_vals * n_words; i++)
+      s[i].init();
+    for (int i=0; i<n; i++) {
+      int v = td[i*a+p];
+      // Find range for value
+      unsigned int l=0U, h=pi.n_ranges-1U;
+      while (true) {
+        assert(l<=h);
+        unsigned int m = l + ((h-l) >> 1);
+        if (v < r[m].min)
+          h=m-1U;
+        else if (v > r[m].max)
+          l=m+1U;
+        else {
+          l=m; break;
+        }
+      }
+      TupleSet::BitSetData* b =
+        const_cast<TupleSet::BitSetData*>(r[l].supports(n_words,v));
+      unsigned int k = static_cast<unsigned int>(i);
+      b[k / TupleSet::BitSetData::bpb].set(k % TupleSet::BitSetData::bpb);
+    }
+    return 0;
+  }
+
+  forceinline
+  Jobs::Jobs(Support::Job<int>** j0, int n0)
+    : j(j0), n(n0), i(0) {}
+  forceinline bool
+  Jobs::operator ()(void) const {
+    return i < n;
+  }
+  forceinline Support::Job<int>*
+  Jobs::job(void) {
+    return j[i++];
+  }
 
 }}}
 
@@ -112,6 +357,10 @@ namespace Gecode {
       return;
     }
 
+    // Number of threads to use
+    unsigned int n_threads =
+      (n_tuples >= par_tuples) ? std::max(Support::Thread::npu(),1U) : 1U;
+
     // Compact and copy data
     Region r;
     // Set up tuple pointers
@@ -119,8 +368,7 @@ namespace Gecode {
     {
       for (int t=0; t<n_tuples; t++)
         tuple[t] = td + t*arity;
-      TupleCompare tc(arity);
-      Support::quicksort(tuple, n_tuples, tc);
+      sort(tuple, n_tuples, arity, n_threads);
       // Remove duplicates
       int j=1;
       for (int t=1; t<n_tuples; t++) {
@@ -155,88 +403,53 @@ namespace Gecode {
 
     // Compute range information
     {
+      PosInfo* pi = r.alloc<PosInfo>(arity);
+      Support::Job<int>** j = r.alloc<Support::Job<int>*>(arity);
       /*
-       * Pass one: compute how many values and ranges are needed
+       * Pass one: compute values and ranges for each position
        */
+      for (int a=0; a<arity; a++)
+        j[a] = new RangeJob(td,n_tuples,arity,a,pi[a]);
+      run(j,arity,n_threads);
       // How many values
       unsigned int n_vals = 0U;
       // How many ranges
       unsigned int n_ranges = 0U;
       for (int a=0; a<arity; a++) {
-        // Sort tuple according to position
-        PosCompare pc(a);
-        Support::quicksort(tuple, n_tuples, pc);
-        // Scan values
-        {
-          int max=tuple[0][a];
-          n_vals++; n_ranges++;
-          for (int i=1; i<n_tuples; i++) {
-            assert(tuple[i-1][a] <= tuple[i][a]);
-            if (max+1 == tuple[i][a]) {
-              n_vals++;
-              max=tuple[i][a];
-            } else if (max+1 < tuple[i][a]) {
-              n_vals++; n_ranges++;
-              max=tuple[i][a];
-            } else {
-              assert(max == tuple[i][a]);
-            }
-          }
-        }
+        n_vals += pi[a].n_vals; n_ranges += pi[a].n_ranges;
       }
       /*
        * Pass 2: allocate memory and fill data structures
        */
       // Allocate memory for ranges
       Range* cr = range = heap.alloc<Range>(n_ranges);
-      // Allocate and initialize memory for supports
+      // Allocate memory for supports
       BitSetData* cs = support = heap.alloc<BitSetData>(n_words * n_vals);
-      for (unsigned int i=0; i<n_vals * n_words; i++)
-        cs[i].init();
       for (int a=0; a<arity; a++) {
-        // Set range pointer
+        // Set range pointer and copy ranges
         vd[a].r = cr;
-        // Sort tuple according to position
-        PosCompare pc(a);
-        Support::quicksort(tuple, n_tuples, pc);
+        vd[a].n = pi[a].n_ranges;
+        Heap::copy(cr,pi[a].r,pi[a].n_ranges);
+        heap.rfree(pi[a].r);
+        pi[a].r = cr;
+        cr += pi[a].n_ranges;
         // Update min and max
-        min = std::min(min,tuple[0][a]);
-        max = std::max(max,tuple[n_tuples-1][a]);
-        // Compress into non-overlapping ranges
-        {
-          unsigned int j=0U;
-          vd[a].r[0].max=vd[a].r[0].min=tuple[0][a];
-          for (int i=1; i<n_tuples; i++) {
-            assert(tuple[i-1][a] <= tuple[i][a]);
-            if (vd[a].r[j].max+1 == tuple[i][a]) {
-              vd[a].r[j].max=tuple[i][a];
-            } else if (vd[a].r[j].max+1 < tuple[i][a]) {
-              j++; vd[a].r[j].min=vd[a].r[j].max=tuple[i][a];
-            } else {
-              assert(vd[a].r[j].max == tuple[i][a]);
-            }
-          }
-          vd[a].n = j+1U;
-          cr += j+1U;
-        }
-        // Set support pointer and set bits
+        min = std::min(min,vd[a].r[0].min);
+        max = std::max(max,vd[a].r[vd[a].n-1].max);
+        // Set support pointer
         for (unsigned int i=0U; i<vd[a].n; i++) {
           vd[a].r[i].s = cs;
           cs += n_words * vd[a].r[i].width();
         }
-        {
-          int j=0;
-          for (int i=0; i<n_tuples; i++) {
-            while (tuple[i][a] > vd[a].r[j].max)
-              j++;
-            set(const_cast<BitSetData*>
-                (vd[a].r[j].supports(n_words,tuple[i][a])),
-                tuple2idx(tuple[i]));
-          }
-        }
       }
       assert(cs == support + n_words * n_vals);
       assert(cr == range + n_ranges);
+      /*
+       * Pass 3: initialize supports for each position
+       */
+      for (int a=0; a<arity; a++)
+        j[a] = new SupportJob(td,n_tuples,arity,a,n_words,pi[a]);
+      run(j,arity,n_threads);
     }
     if ((min < Int::Limits::min) || (max > Int::Limits::max))
       throw Int::OutOfLimits("TupleSet::finalize()");
@@ -252,10 +465,18 @@ namespace Gecode {
   }
 
   TupleSet::Data::~Data(void) {
-    heap.rfree(td);
+    if (mapped != nullptr) {
+#ifdef GECODE_HAS_UNISTD_H
+      ::munmap(mapped,n_mapped);
+#else
+      heap.rfree(mapped);
+#endif
+    } else {
+      heap.rfree(td);
+      heap.rfree(support);
+    }
     heap.rfree(vd);
     heap.rfree(range);
-    heap.rfree(support);
   }
 
 
@@ -443,6 +664,247 @@ namespace Gecode {
     finalize();
   } 
 
+  /*
+   * Tuple set files
+   *
+   */
+
+  namespace Int { namespace Extensional {
+
+  /// Header of a tuple set file
+  class FileHeader {
+  public:
+    /// Magic number
+    unsigned int magic;
+    /// Version of file format
+    unsigned int version;
+    /// Size of a bit set word (for checking compatibility)
+    unsigned int bsd;
+    /// Arity
+    int arity;
+    /// Number of tuples
+    int n_tuples;
+    /// Number of words for support
+    unsigned int n_words;
+    /// Number of ranges
+    unsigned int n_ranges;
+    /// Number of values
+    unsigned int n_vals;
+    /// Smallest value
+    int min;
+    /// Largest value
+    int max;
+    /// Hash key
+    unsigned long long int key;
+  };
+
+  /// Magic number for tuple set files
+  const unsigned int file_magic = 0x53544547U;
+  /// Version of tuple set files
+  const unsigned int file_version = 1U;
+
+  /// Align file offset \a o to eight bytes
+  forceinline std::size_t
+  file_align(std::size_t o) {
+    return (o + 7U) & ~static_cast<std::size_t>(7U);
+  }
+
+  /// Offsets of the parts of a tuple set file
+  class FileLayout {
+  public:
+    /// Offset of number of ranges per position
+    std::size_t n;
+    /// Offset of ranges (as pairs of minimum and maximum)
+    std::size_t r;
+    /// Offset of tuple data
+    std::size_t td;
+    /// Offset of support data
+    std::size_t s;
+    /// Size of file
+    std::size_t size;
+    /// Compute layout for header \a h
+    FileLayout(const FileHeader& h) {
+      n    = file_align(sizeof(FileHeader));
+      r    = file_align(n + sizeof(unsigned int) * h.arity);
+      td   = file_align(r + 2U * sizeof(int) * h.n_ranges);
+      s    = file_align(td + sizeof(int) *
+                        static_cast<std::size_t>(h.n_tuples) * h.arity);
+      size = s + sizeof(TupleSet::BitSetData) *
+        static_cast<std::size_t>(h.n_words) * h.n_vals;
+    }
+  };
+
+  /// Write \a n bytes from \a p at offset \a o to file \a f
+  bool
+  file_write(FILE* f, std::size_t o, const void* p, std::size_t n) {
+    static const char zero[8] = {0,0,0,0,0,0,0,0};
+    long int c = std::ftell(f);
+    if ((c < 0) || (static_cast<std::size_t>(c) > o) ||
+        (o - static_cast<std::size_t>(c) > sizeof(zero)))
+      return false;
+    std::size_t z = o - static_cast<std::size_t>(c);
+    return ((z == 0U) || (std::fwrite(zero,1,z,f) == z)) &&
+      ((n == 0U) || (std::fwrite(p,1,n,f) == n));
+  }
+
+  /// Read header \a h from file data \a f of size \a n and check data
+  bool
+  file_check(FileHeader& h, const char* f, std::size_t n) {
+    std::memcpy(&h,f,sizeof(FileHeader));
+    if ((h.magic != file_magic) || (h.version != file_version) ||
+        (h.bsd != sizeof(TupleSet::BitSetData)) || (h.arity <= 0) ||
+        (h.n_tuples < 0) || (FileLayout(h).size != n))
+      return false;
+    FileLayout l(h);
+    // Check that ranges match the number of ranges and values
+    const unsigned int* r = reinterpret_cast<const unsigned int*>(f + l.n);
+    const int* mm = reinterpret_cast<const int*>(f + l.r);
+    unsigned int n_ranges = 0U;
+    for (int a=0; a<h.arity; a++)
+      n_ranges += r[a];
+    if (n_ranges != h.n_ranges)
+      return false;
+    unsigned int n_vals = 0U;
+    for (unsigned int i=0U; i<n_ranges; i++) {
+      if (mm[2U*i] > mm[2U*i+1U])
+        return false;
+      n_vals += static_cast<unsigned int>(mm[2U*i+1U] - mm[2U*i] + 1);
+    }
+    return n_vals == h.n_vals;
+  }
+
+  }}
+
+  void
+  TupleSet::save(const char* fn) const {
+    using namespace Int::Extensional;
+    if (!*this)
+      throw Int::UninitializedTupleSet("TupleSet::save()");
+    if (!raw().finalized())
+      throw Int::NotYetFinalized("TupleSet::save()");
+    const Data& d = data();
+    FileHeader h;
+    h.magic = file_magic; h.version = file_version;
+    h.bsd = sizeof(BitSetData);
+    h.arity = d.arity; h.n_tuples = d.n_tuples; h.n_words = d.n_words;
+    h.n_ranges = 0U; h.n_vals = 0U;
+    h.min = d.min; h.max = d.max;
+    h.key = static_cast<unsigned long long int>(d.key);
+    Region r;
+    unsigned int* n = r.alloc<unsigned int>(d.arity);
+    for (int a=0; a<d.arity; a++) {
+      n[a] = (d.n_tuples > 0) ? d.vd[a].n : 0U;
+      h.n_ranges += n[a];
+      for (unsigned int i=0U; i<n[a]; i++)
+        h.n_vals += d.vd[a].r[i].width();
+    }
+    int* mm = r.alloc<int>(2U * h.n_ranges);
+    for (unsigned int i=0U; i<h.n_ranges; i++) {
+      mm[2U*i] = d.range[i].min; mm[2U*i+1U] = d.range[i].max;
+    }
+    FileLayout l(h);
+    // Write to temporary file first so that mapped files remain intact
+    std::string tmp = std::string(fn) + ".tmp";
+    FILE* f = std::fopen(tmp.c_str(),"wb");
+    if (f == NULL)
+      throw Int::TupleSetFileError("TupleSet::save()");
+    bool ok =
+      file_write(f,0U,&h,sizeof(FileHeader)) &&
+      file_write(f,l.n,n,sizeof(unsigned int) * d.arity) &&
+      file_write(f,l.r,mm,2U * sizeof(int) * h.n_ranges) &&
+      file_write(f,l.td,d.td,sizeof(int) *
+                 static_cast<std::size_t>(d.n_tuples) * d.arity) &&
+      file_write(f,l.s,d.support,l.size - l.s);
+    ok = (std::fclose(f) == 0) && ok;
+    if (!ok || (std::rename(tmp.c_str(),fn) != 0)) {
+      (void) std::remove(tmp.c_str());
+      throw Int::TupleSetFileError("TupleSet::save()");
+    }
+  }
+
+  TupleSet::TupleSet(const char* fn) {
+    using namespace Int::Extensional;
+    // Read and map file
+    std::size_t size = 0U;
+    char* f = NULL;
+#ifdef GECODE_HAS_UNISTD_H
+    {
+      int fd = ::open(fn, O_RDONLY);
+      if (fd < 0)
+        throw Int::TupleSetFileError("TupleSet::TupleSet()");
+      struct stat st;
+      if ((::fstat(fd,&st) == 0) && (st.st_size > 0)) {
+        size = static_cast<std::size_t>(st.st_size);
+        void* m = ::mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+        if (m != MAP_FAILED)
+          f = static_cast<char*>(m);
+      }
+      ::close(fd);
+      if (f == NULL)
+        throw Int::TupleSetFileError("TupleSet::TupleSet()");
+    }
+#else
+    {
+      FILE* fp = std::fopen(fn,"rb");
+      if (fp == NULL)
+        throw Int::TupleSetFileError("TupleSet::TupleSet()");
+      if ((std::fseek(fp,0,SEEK_END) == 0) && (std::ftell(fp) > 0)) {
+        size = static_cast<std::size_t>(std::ftell(fp));
+        f = heap.alloc<char>(size);
+        if ((std::fseek(fp,0,SEEK_SET) != 0) ||
+            (std::fread(f,1,size,fp) != size)) {
+          heap.rfree(f); f = NULL;
+        }
+      }
+      std::fclose(fp);
+      if (f == NULL)
+        throw Int::TupleSetFileError("TupleSet::TupleSet()");
+    }
+#endif
+    FileHeader h;
+    if ((size < sizeof(FileHeader)) || !file_check(h,f,size)) {
+#ifdef GECODE_HAS_UNISTD_H
+      ::munmap(f,size);
+#else
+      heap.rfree(f);
+#endif
+      throw Int::TupleSetFileError("TupleSet::TupleSet()");
+    }
+    FileLayout l(h);
+    // Set up data, tuples and supports are used in place
+    Data* d = new Data(h.arity);
+    object(d);
+    heap.rfree(d->td);
+    d->n_free = -1;
+    d->n_tuples = h.n_tuples; d->n_words = h.n_words;
+    d->min = h.min; d->max = h.max;
+    d->key = static_cast<std::size_t>(h.key);
+    d->mapped = f; d->n_mapped = size;
+    if (h.n_tuples == 0) {
+      d->td = nullptr;
+      return;
+    }
+    d->td = reinterpret_cast<int*>(f + l.td);
+    d->support = reinterpret_cast<BitSetData*>(f + l.s);
+    // Ranges must be relocated to point to supports
+    d->range = heap.alloc<Range>(h.n_ranges);
+    const unsigned int* n = reinterpret_cast<const unsigned int*>(f + l.n);
+    const int* mm = reinterpret_cast<const int*>(f + l.r);
+    Range* cr = d->range;
+    BitSetData* cs = d->support;
+    for (int a=0; a<h.arity; a++) {
+      d->vd[a].n = n[a];
+      d->vd[a].r = cr;
+      for (unsigned int i=0U; i<n[a]; i++) {
+        cr->min = *(mm++); cr->max = *(mm++);
+        cr->s = cs;
+        cs += h.n_words * cr->width();
+        cr++;
+      }
+    }
+    assert(cs == d->support + h.n_words * h.n_vals);
+  }
+
   bool
   TupleSet::equal(const TupleSet& t) const {
     assert(tuples() == t.tuples());
@@ -64,7 +64,7 @@ namespace Gecode {
       min(Int::Limits::max), max(Int::Limits::min), key(0),
       td(heap.alloc<int>(n_initial_free * a)),
       vd(heap.alloc<ValueData>(a)),
-      range(nullptr), support(nullptr) {
+      range(nullptr), support(nullptr), mapped(nullptr), n_mapped(0) {
   }
   
   forceinline bool
@@ -478,16 +478,6 @@ namespace Gecode { namespace Int { namespace GCC {
     template<BC>
     bool augmenting_path(Node*);
 
-  protected:
-    /**
-     * \brief Perform depth-first search on the graph
-     *
-     * Depth first search used to compute the
-     * strongly connected components of the graph.
-     */
-    template<BC>
-    void dfs(Node*, BitSet&, BitSet&, int[],
-             NodeStack&, NodeStack&, int&);
 
     //@}
   public:
@@ -1156,16 +1146,9 @@ namespace Gecode { namespace Int { namespace GCC {
     // nodes in sp only follow free edges
     // nodes in V - sp only follow matched edges
 
-    for (int i = n_node; i--; )
-      if (i >= n_var) {
-        vals[i-n_var]->inedge(NULL);
-        start[i] = vals[i-n_var]->first();
-      } else {
-        vars[i]->inedge(NULL);
-        start[i] = vars[i]->first();
-      }
-
+    // Only nodes that are visited are initialized
     v->inedge(NULL);
+    start[v->index()] = v->first();
     ns.push(v);
     visited.set(static_cast<unsigned int>(v->index()));
     while (!ns.empty()) {
@@ -1202,6 +1185,7 @@ namespace Gecode { namespace Int { namespace GCC {
             }
           } else {
             w->inedge(e);
+            start[w->index()] = w->first();
             visited.set(static_cast<unsigned int>(w->index()));
             // find matching edge m incident with w
             ns.push(w);
@@ -1676,70 +1660,6 @@ namespace Gecode { namespace Int { namespace GCC {
     }
   }
 
-  template<class Card> template<BC bc>
-  void
-  VarValGraph<Card>::dfs(Node* v,
-                         BitSet& inscc, BitSet& in_unfinished, int dfsnum[],
-                         NodeStack& roots, NodeStack& unfinished,
-                         int& count) {
-    count++;
-    int v_index            = v->index();
-    dfsnum[v_index]        = count;
-    inscc.set(static_cast<unsigned int>(v_index));
-    in_unfinished.set(static_cast<unsigned int>(v_index));
-
-    unfinished.push(v);
-    roots.push(v);
-    for (Edge* e = v->first(); e != NULL; e = e->next(v->type())) {
-      bool m;
-      switch (bc) {
-      case LBC:
-        m = v->type() ? e->matched(LBC) : !e->matched(LBC);
-        break;
-      case UBC:
-        m = v->type() ? !e->matched(UBC) : e->matched(UBC);
-        break;
-      default: GECODE_NEVER;
-      }
-      if (m) {
-        Node* w = e->getMate(v->type());
-        int w_index = w->index();
-
-        assert(w_index < n_node);
-        if (!inscc.get(static_cast<unsigned int>(w_index))) {
-          // w is an uncompleted scc
-          w->inedge(e);
-          dfs<bc>(w, inscc, in_unfinished, dfsnum,
-                  roots, unfinished, count);
-        } else if (in_unfinished.get(static_cast<unsigned int>(w_index))) {
-          // even alternating cycle found mark the edge closing the cycle,
-          // completing the scc
-          e->use(bc);
-          // if w belongs to an scc we detected earlier
-          // merge components
-          assert(roots.top()->index() < n_node);
-          while (dfsnum[roots.top()->index()] > dfsnum[w_index]) {
-            roots.pop();
-          }
-        }
-      }
-    }
-
-    if (v == roots.top()) {
-      while (v != unfinished.top()) {
-        // w belongs to the scc with root v
-        Node* w = unfinished.top();
-        w->inedge()->use(bc);
-        in_unfinished.clear(static_cast<unsigned int>(w->index()));
-        unfinished.pop();
-      }
-      assert(v == unfinished.top());
-      in_unfinished.clear(static_cast<unsigned int>(v_index));
-      roots.pop();
-      unfinished.pop();
-    }
-  }
-
   template<class Card> template<BC bc>
   forceinline void
   VarValGraph<Card>::strongly_connected_components(void) {
@@ -1747,17 +1667,92 @@ namespace Gecode { namespace Int { namespace GCC {
     BitSet inscc(r,static_cast<unsigned int>(n_node));
     BitSet in_unfinished(r,static_cast<unsigned int>(n_node));
     int* dfsnum = r.alloc<int>(n_node);
-
-    for (int i = n_node; i--; )
-      dfsnum[i]=0;
+    // Edge to continue with for each node on the visit stack
+    Edge** iter = r.alloc<Edge*>(n_node);
 
     int count = 0;
     NodeStack roots(r,n_node);
     NodeStack unfinished(r,n_node);
+    // Nodes whose depth-first search is suspended
+    NodeStack visit(r,n_node);
 
+    /*
+     * Path-based depth-first search with an explicit stack: nodes in
+     * roots are the roots of the components that are not yet completed,
+     * nodes in unfinished are all nodes not yet assigned to a component.
+     */
     for (int i = n_var; i--; )
-      dfs<bc>(vars[i], inscc, in_unfinished, dfsnum,
-              roots, unfinished, count);
+      if (!inscc.get(static_cast<unsigned int>(vars[i]->index()))) {
+        Node* v = vars[i];
+        Edge* e;
+      start:
+        count++;
+        dfsnum[v->index()] = count;
+        inscc.set(static_cast<unsigned int>(v->index()));
+        in_unfinished.set(static_cast<unsigned int>(v->index()));
+        unfinished.push(v);
+        roots.push(v);
+        e = v->first();
+        while (e != NULL) {
+          {
+            bool m;
+            switch (bc) {
+            case LBC:
+              m = v->type() ? e->matched(LBC) : !e->matched(LBC);
+              break;
+            case UBC:
+              m = v->type() ? !e->matched(UBC) : e->matched(UBC);
+              break;
+            default: GECODE_NEVER;
+            }
+            if (m) {
+              Node* w = e->getMate(v->type());
+              int w_index = w->index();
+
+              assert(w_index < n_node);
+              if (!inscc.get(static_cast<unsigned int>(w_index))) {
+                // w is an uncompleted scc: continue with w
+                w->inedge(e);
+                iter[v->index()] = e;
+                visit.push(v);
+                v = w;
+                goto start;
+              } else if (in_unfinished.get(static_cast<unsigned int>(w_index))) {
+                // even alternating cycle found mark the edge closing the
+                // cycle, completing the scc
+                e->use(bc);
+                // if w belongs to an scc we detected earlier
+                // merge components
+                assert(roots.top()->index() < n_node);
+                while (dfsnum[roots.top()->index()] > dfsnum[w_index])
+                  roots.pop();
+              }
+            }
+          }
+        next:
+          e = e->next(v->type());
+        }
+
+        if (v == roots.top()) {
+          while (v != unfinished.top()) {
+            // w belongs to the scc with root v
+            Node* w = unfinished.top();
+            w->inedge()->use(bc);
+            in_unfinished.clear(static_cast<unsigned int>(w->index()));
+            unfinished.pop();
+          }
+          assert(v == unfinished.top());
+          in_unfinished.clear(static_cast<unsigned int>(v->index()));
+          roots.pop();
+          unfinished.pop();
+        }
+
+        if (!visit.empty()) {
+          // Resume the node from which v has been reached
+          v = visit.pop(); e = iter[v->index()];
+          goto next;
+        }
+      }
   }
 
   template<class Card>
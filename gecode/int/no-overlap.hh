@@ -223,6 +223,14 @@ namespace Gecode { namespace Int { namespace NoOverlap {
 
 namespace Gecode { namespace Int { namespace NoOverlap {
 
+  /// Sort order for boxes by earliest start in the first dimension
+  template<class Box>
+  class BoxBySsc {
+  public:
+    /// Sort order
+    bool operator ()(const Box& b1, const Box& b2) const;
+  };
+
   /**
    * \brief Base class for no-overlap propagator
    *
@@ -247,6 +255,19 @@ namespace Gecode { namespace Int { namespace NoOverlap {
      * Returns the number of mandatory boxes at the front of \a b.
      */
     static int partition(Box* b, int i, int n);
+    /**
+     * \brief Propagate for all pairs of mandatory boxes
+     *
+     * The mandatory boxes are swept along the first dimension: only
+     * pairs of boxes that might overlap in the first dimension are
+     * considered. The mandatory boxes are kept sorted by their earliest
+     * start in the first dimension, so that sorting them again is
+     * cheap as long as only few boxes change.
+     *
+     * Returns in \a db for each mandatory box the number of boxes it
+     * might still overlap with.
+     */
+    ExecStatus sweep(Space& home, int* db);
   public:
     /// Cost function
     virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
@@ -33,6 +33,12 @@
 
 namespace Gecode { namespace Int { namespace NoOverlap {
 
+  template<class Box>
+  forceinline bool
+  BoxBySsc<Box>::operator ()(const Box& b1, const Box& b2) const {
+    return b1[0].ssc() < b2[0].ssc();
+  }
+
   template<class Box>
   forceinline
   Base<Box>::Base(Home home, Box* b0, int n0)
@@ -54,6 +60,46 @@ namespace Gecode { namespace Int { namespace NoOverlap {
     return i;
   }
 
+  template<class Box>
+  ExecStatus
+  Base<Box>::sweep(Space& home, int* db) {
+    // Sort boxes, they are almost sorted from the previous sweep
+    BoxBySsc<Box> o;
+    Support::insertion(b, n, o);
+
+    Region r;
+
+    // Earliest start and latest end in first dimension before sweeping
+    int* ssc = r.alloc<int>(n);
+    int* lec = r.alloc<int>(n);
+    for (int i=0; i<n; i++) {
+      ssc[i] = b[i][0].ssc(); lec[i] = b[i][0].lec();
+      db[i] = 0;
+    }
+
+    // Boxes that might overlap with the current box in first dimension
+    int* a = r.alloc<int>(n);
+    int k = 0;
+
+    for (int i=0; i<n; i++) {
+      int l = 0;
+      for (int m=0; m<k; m++) {
+        int j = a[m];
+        // Box j ends before box i and all following boxes start
+        if (lec[j] <= ssc[i])
+          continue;
+        a[l++] = j;
+        if (!b[i].nooverlap(b[j])) {
+          db[i]++; db[j]++;
+          GECODE_ES_CHECK(b[i].nooverlap(home,b[j]));
+        }
+      }
+      k = l;
+      a[k++] = i;
+    }
+    return ES_OK;
+  }
+
   template<class Box>
   forceinline size_t
   Base<Box>::dispose(Space& home) {
@@ -92,24 +92,16 @@ namespace Gecode { namespace Int { namespace NoOverlap {
       }
     }
 
-    // Number of disjoint boxes
+    // Number of boxes a box might still overlap with
     int* db = r.alloc<int>(n);
-    for (int i=0; i<n; i++)
-      db[i] = n-1;
+    GECODE_ES_CHECK(this->sweep(home,db));
 
     // Number of boxes to be eliminated
     int e = 0;
     for (int i=0; i<n; i++) {
       assert(b[i].mandatory());
-      for (int j=0; j<i; j++)
-        if (b[i].nooverlap(b[j])) {
-          assert(db[i] > 0); assert(db[j] > 0);
-          if (--db[i] == 0) e++;
-          if (--db[j] == 0) e++;
-          continue;
-        } else {
-          GECODE_ES_CHECK(b[i].nooverlap(home,b[j]));
-        }
+      if (db[i] == 0)
+        e++;
     }
 
     if (m == 0) {
@@ -514,6 +514,10 @@ namespace Gecode { namespace Int {
     int idx(void) const;
     /// Order among events
     bool operator <(const Event& e) const;
+    /// Test whether events are equal
+    bool operator ==(const Event& e) const;
+    /// Test whether events are different
+    bool operator !=(const Event& e) const;
     /// Allocate from \a r and initialize event array with tasks \a t
     template<class Task>
     static Event* events(Region& r, const TaskArray<Task>& t, bool& assigned);
@@ -531,6 +535,75 @@ namespace Gecode { namespace Int {
 
 #include <gecode/int/task/event.hpp>
 
+namespace Gecode { namespace Int {
+
+  /**
+   * \brief Incremental time-tabling profile
+   *
+   * The profile keeps a copy of the tasks in a fixed order (the tasks
+   * of a propagator are reordered by the other filtering algorithms)
+   * together with the sorted events of all tasks. When the events are
+   * requested, only the events of tasks that changed since the
+   * last request are removed, sorted, and merged with the remaining
+   * events. Hence, the events need not be sorted from scratch.
+   *
+   * The profile is initialized lazily and is copied during cloning.
+   *
+   */
+  template<class Task>
+  class Profile {
+  protected:
+    /// Number of events per task
+    static const int n_te = 4;
+    /// The tasks in fixed order
+    TaskArray<Task> t;
+    /// The sorted events followed by an end marker
+    Event* e;
+    /// Number of events (excluding the end marker)
+    int n;
+    /// The current events of each task (padded with end markers)
+    Event* te;
+    /// Compute events for task \a i into \a f
+    void events(int i, Event* f, bool& assigned, bool& required) const;
+  public:
+    /// \name Constructors and initialization
+    //@{
+    /// Default constructor (not yet initialized)
+    Profile(void);
+    /// Whether profile has been initialized
+    bool initialized(void) const;
+    /// Initialize from tasks \a t (the order of \a t is kept)
+    void init(Space& home, const TaskArray<Task>& t);
+    //@}
+
+    /// \name Tasks and events
+    //@{
+    /// Return number of tasks
+    int size(void) const;
+    /// Return task at position \a i
+    Task& operator [](int i);
+    /// Return task at position \a i
+    const Task& operator [](int i) const;
+    /**
+     * \brief Return sorted events with end marker
+     *
+     * Returns NULL if no task has a required part. The events remain
+     * valid until the next call.
+     */
+    Event* events(Region& r, bool& assigned);
+    //@}
+
+    /// \name Cloning
+    //@{
+    /// Update profile to be a clone of profile \a p
+    void update(Space& home, Profile<Task>& p);
+    //@}
+  };
+
+}}
+
+#include <gecode/int/task/profile.hpp>
+
 #endif
 
 // STATISTICS: int-prop
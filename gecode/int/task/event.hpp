@@ -53,9 +53,21 @@ namespace Gecode { namespace Int {
 
   forceinline bool
   Event::operator <(const Event& e) const {
-    if (time() == e.time())
+    if (time() != e.time())
+      return time() < e.time();
+    if (type() != e.type())
       return type() < e.type();
-    return time() < e.time();
+    // Order must be total so that incremental and full sorting agree
+    return idx() < e.idx();
+  }
+
+  forceinline bool
+  Event::operator ==(const Event& e) const {
+    return (ei == e.ei) && (t == e.t);
+  }
+  forceinline bool
+  Event::operator !=(const Event& e) const {
+    return !(*this == e);
   }
 
 
@@ -0,0 +1,178 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+namespace Gecode { namespace Int {
+
+  template<class Task>
+  forceinline
+  Profile<Task>::Profile(void)
+    : e(NULL), n(0), te(NULL) {}
+
+  template<class Task>
+  forceinline bool
+  Profile<Task>::initialized(void) const {
+    return e != NULL;
+  }
+
+  template<class Task>
+  forceinline void
+  Profile<Task>::init(Space& home, const TaskArray<Task>& t0) {
+    assert(!initialized());
+    t = TaskArray<Task>(home,t0.size());
+    for (int i=0; i<t.size(); i++)
+      t[i]=t0[i];
+    e = home.alloc<Event>(n_te*t.size()+1);
+    te = home.alloc<Event>(n_te*t.size());
+    // No task has events yet
+    n = 0;
+    for (int i=0; i<n_te*t.size(); i++)
+      te[i].init(Event::END,Limits::infinity,0);
+    e[n].init(Event::END,Limits::infinity,0);
+  }
+
+  template<class Task>
+  forceinline int
+  Profile<Task>::size(void) const {
+    return t.size();
+  }
+
+  template<class Task>
+  forceinline Task&
+  Profile<Task>::operator [](int i) {
+    return t[i];
+  }
+  template<class Task>
+  forceinline const Task&
+  Profile<Task>::operator [](int i) const {
+    return t[i];
+  }
+
+  template<class Task>
+  forceinline void
+  Profile<Task>::events(int i, Event* f, bool& assigned,
+                        bool& required) const {
+    int k=0;
+    if (t[i].excluded()) {
+      // Excluded tasks do not have events
+    } else if (t[i].assigned()) {
+      // Only add required part
+      if (t[i].pmin() > 0) {
+        required = true;
+        f[k++].init(Event::ERT,t[i].lst(),i);
+        f[k++].init(Event::LRT,t[i].ect(),i);
+      } else if (t[i].pmax() == 0) {
+        required = true;
+        f[k++].init(Event::ZRO,t[i].lst(),i);
+      }
+    } else {
+      assigned = false;
+      f[k++].init(Event::EST,t[i].est(),i);
+      f[k++].init(Event::LCT,t[i].lct(),i);
+      // Check whether task has required part
+      if (t[i].lst() < t[i].ect()) {
+        required = true;
+        f[k++].init(Event::ERT,t[i].lst(),i);
+        f[k++].init(Event::LRT,t[i].ect(),i);
+      }
+    }
+    for ( ; k<n_te; k++)
+      f[k].init(Event::END,Limits::infinity,0);
+  }
+
+  template<class Task>
+  Event*
+  Profile<Task>::events(Region& r, bool& assigned) {
+    assert(initialized());
+    assigned=true;
+    bool required=false;
+
+    // Events of tasks that have changed
+    Event* c = r.alloc<Event>(n_te*t.size());
+    int m=0;
+    // Which tasks have changed
+    Support::BitSet<Region> d(r,static_cast<unsigned int>(t.size()));
+    bool changed=false;
+
+    for (int i=0; i<t.size(); i++) {
+      Event f[n_te];
+      events(i,f,assigned,required);
+      Event* g = te+n_te*i;
+      if ((f[0] != g[0]) || (f[1] != g[1]) ||
+          (f[2] != g[2]) || (f[3] != g[3])) {
+        changed = true;
+        d.set(static_cast<unsigned int>(i));
+        for (int k=0; k<n_te; k++) {
+          g[k]=f[k];
+          if (f[k].type() != Event::END)
+            c[m++]=f[k];
+        }
+      }
+    }
+
+    if (changed) {
+      // Remove events of changed tasks
+      int k=0;
+      for (int i=0; i<n; i++)
+        if (!d.get(static_cast<unsigned int>(e[i].idx())))
+          e[k++]=e[i];
+      // Sort new events
+      Support::quicksort(c, m);
+      // Merge remaining and new events from the end
+      n = k+m;
+      for (int i=n; m > 0; )
+        if ((k > 0) && (c[m-1] < e[k-1]))
+          e[--i]=e[--k];
+        else
+          e[--i]=c[--m];
+      // Write end marker
+      e[n].init(Event::END,Limits::infinity,0);
+    }
+
+    return required ? e : NULL;
+  }
+
+  template<class Task>
+  forceinline void
+  Profile<Task>::update(Space& home, Profile<Task>& p) {
+    if (p.initialized()) {
+      t.update(home,p.t);
+      n = p.n;
+      e = Heap::copy(home.alloc<Event>(n_te*t.size()+1),p.e,n+1);
+      te = Heap::copy(home.alloc<Event>(n_te*t.size()),p.te,n_te*t.size());
+    }
+  }
+
+}}
+
+// STATISTICS: int-prop
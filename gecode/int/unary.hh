@@ -754,9 +754,15 @@ namespace Gecode { namespace Int { namespace Unary {
   template<class OptTask, class PL>
   ExecStatus overload(Space& home, Propagator& p, TaskArray<OptTask>& t);
 
-  /// Perform time-tabling propagation
+  /**
+   * \brief Perform time-tabling propagation
+   *
+   * The profile \a tp is initialized from the tasks \a t when
+   * time-tabling is performed first.
+   */
   template<class Task>
-  ExecStatus timetabling(Space& home, Propagator& p, TaskArray<Task>& t);
+  ExecStatus timetabling(Space& home, Propagator& p, TaskArray<Task>& t,
+                         Profile<Task>& tp);
 
   /// Check tasks \a t for subsumption
   template<class Task>
@@ -791,6 +797,8 @@ namespace Gecode { namespace Int { namespace Unary {
   class ManProp : public TaskProp<ManTask,PL> {
   protected:
     using TaskProp<ManTask,PL>::t;
+    /// Profile for time-tabling
+    Profile<ManTask> tp;
     /// Constructor for creation
     ManProp(Home home, TaskArray<ManTask>& t);
     /// Constructor for cloning \a p
@@ -814,6 +822,8 @@ namespace Gecode { namespace Int { namespace Unary {
   class OptProp : public TaskProp<OptTask,PL> {
   protected:
     using TaskProp<OptTask,PL>::t;
+    /// Profile for time-tabling
+    Profile<OptTask> tp;
     /// Constructor for creation
     OptProp(Home home, TaskArray<OptTask>& t);
     /// Constructor for cloning \a p
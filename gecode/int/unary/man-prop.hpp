@@ -41,7 +41,9 @@ namespace Gecode { namespace Int { namespace Unary {
   template<class ManTask, class PL>
   forceinline
   ManProp<ManTask,PL>::ManProp(Space& home, ManProp<ManTask,PL>& p)
-    : TaskProp<ManTask,PL>(home,p) {}
+    : TaskProp<ManTask,PL>(home,p) {
+    tp.update(home,p.tp);
+  }
 
   template<class ManTask, class PL>
   forceinline ExecStatus
@@ -63,7 +65,7 @@ namespace Gecode { namespace Int { namespace Unary {
     GECODE_ES_CHECK(overload(t));
 
     if (PL::basic)
-      GECODE_ES_CHECK(timetabling(home,*this,t));
+      GECODE_ES_CHECK(timetabling(home,*this,t,tp));
 
     if (PL::advanced) {
       GECODE_ES_CHECK(detectable(home,t));
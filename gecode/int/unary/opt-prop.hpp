@@ -43,7 +43,9 @@ namespace Gecode { namespace Int { namespace Unary {
   template<class OptTask, class PL>
   forceinline
   OptProp<OptTask,PL>::OptProp(Space& home, OptProp<OptTask,PL>& p)
-    : TaskProp<OptTask,PL>(home,p) {}
+    : TaskProp<OptTask,PL>(home,p) {
+    tp.update(home,p.tp);
+  }
 
   template<class OptTask, class PL>
   ExecStatus
@@ -82,7 +84,7 @@ namespace Gecode { namespace Int { namespace Unary {
     GECODE_ES_CHECK((overload<OptTask,PL>(home,*this,t)));
 
     if (PL::basic)
-      GECODE_ES_CHECK(timetabling(home,*this,t));
+      GECODE_ES_CHECK(timetabling(home,*this,t,tp));
 
     if (PL::advanced) {
       GECODE_ES_CHECK((detectable<OptTask,PL>(home,*this,t)));
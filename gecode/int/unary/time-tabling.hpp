@@ -37,15 +37,19 @@ namespace Gecode { namespace Int { namespace Unary {
 
   template<class Task>
   ExecStatus
-  timetabling(Space& home, Propagator& p, TaskArray<Task>& t) {
+  timetabling(Space& home, Propagator& p, TaskArray<Task>& t,
+              Profile<Task>& tp) {
+    if (!tp.initialized())
+      tp.init(home,t);
+
     Region r;
 
     bool assigned;
-    if (Event* e = Event::events(r,t,assigned)) {
+    if (Event* e = tp.events(r,assigned)) {
       // Whether resource is free
       bool free = true;
       // Set of current but not required tasks
-      Support::BitSet<Region> tasks(r,static_cast<unsigned int>(t.size()));
+      Support::BitSet<Region> tasks(r,static_cast<unsigned int>(tp.size()));
 
       // Process events
       do {
@@ -54,7 +58,7 @@ namespace Gecode { namespace Int { namespace Unary {
 
         // Process events for completion of required part
         for ( ; (e->type() == Event::LRT) && (e->time() == time); e++)
-          if (t[e->idx()].mandatory()) {
+          if (tp[e->idx()].mandatory()) {
             tasks.set(static_cast<unsigned int>(e->idx()));
             free = true;
           }
@@ -76,22 +80,22 @@ namespace Gecode { namespace Int { namespace Unary {
         int nrstime = time;
         // Process events for start of required part
         for ( ; (e->type() == Event::ERT) && (e->time() == time); e++)
-          if (t[e->idx()].mandatory()) {
+          if (tp[e->idx()].mandatory()) {
             tasks.clear(static_cast<unsigned int>(e->idx()));
             if (!free)
               return ES_FAILED;
             free = false;
             nrstime = time+1;
-          } else if (t[e->idx()].optional() && !free) {
-            GECODE_ME_CHECK(t[e->idx()].excluded(home));
+          } else if (tp[e->idx()].optional() && !free) {
+            GECODE_ME_CHECK(tp[e->idx()].excluded(home));
           }
 
         if (!free)
           for (Iter::Values::BitSet<Support::BitSet<Region> > j(tasks);
                j(); ++j)
             // Task j cannot run from time to next time - 1
-            if (t[j.val()].mandatory())
-              GECODE_ME_CHECK(t[j.val()].norun(home, nrstime, e->time() - 1));
+            if (tp[j.val()].mandatory())
+              GECODE_ME_CHECK(tp[j.val()].norun(home, nrstime, e->time() - 1));
 
       } while (e->type() != Event::END);
     }
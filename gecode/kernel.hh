@@ -234,6 +234,7 @@ namespace Gecode {
 #include <gecode/kernel/branch/merit.hpp>
 #include <gecode/kernel/branch/filter.hpp>
 #include <gecode/kernel/branch/view-sel.hpp>
+#include <gecode/kernel/branch/view-sel-heap.hpp>
 #include <gecode/kernel/branch/print.hpp>
 #include <gecode/kernel/branch/view.hpp>
 #include <gecode/kernel/branch/val-sel.hpp>
@@ -283,6 +284,7 @@ namespace Gecode {
 }
 
 #include <gecode/kernel/trace/general.hpp>
+#include <gecode/kernel/trace/profile.hpp>
 
 /*
  * Allocator support
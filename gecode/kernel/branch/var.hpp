@@ -71,6 +71,8 @@ namespace Gecode {
     CHB _chb;
     /// Merit function
     MeritFunction _mf;
+    /// Whether to select with a heap
+    bool _heap;
   public:
     /// Initialize
     VarBranch(void);
@@ -108,28 +110,41 @@ namespace Gecode {
     void chb(CHB chb);
     /// Return merit function
     MeritFunction merit(void) const;
+    /// Return whether to select with a heap
+    bool heap(void) const;
+    /** \brief Set whether to select with a heap
+     *
+     * Instead of scanning all views for each choice, the view with best
+     * merit is maintained in a heap that is updated whenever a domain
+     * changes. The selected views are exactly the same as without a
+     * heap. A heap is only used if the merit depends on the domain
+     * alone (minimum, maximum, size, or regret) and no tie-break limit
+     * function is given. As the heap is maintained by advisors, the
+     * degree and AFC of the variables increase.
+     */
+    void heap(bool h);
   };
 
   // Variable branching
   template<class Var>
   inline
   VarBranch<Var>::VarBranch(void)
-    : _tbl(nullptr), _decay(1.0) {}
+    : _tbl(nullptr), _decay(1.0), _heap(false) {}
 
   template<class Var>
   inline
   VarBranch<Var>::VarBranch(BranchTbl t)
-    : _tbl(t), _decay(1.0) {}
+    : _tbl(t), _decay(1.0), _heap(false) {}
 
   template<class Var>
   inline
   VarBranch<Var>::VarBranch(double d, BranchTbl t)
-    : _tbl(t), _decay(d) {}
+    : _tbl(t), _decay(d), _heap(false) {}
 
   template<class Var>
   inline
   VarBranch<Var>::VarBranch(AFC a, BranchTbl t)
-    : _tbl(t), _decay(1.0), _afc(a) {
+    : _tbl(t), _decay(1.0), _afc(a), _heap(false) {
     if (!_afc)
       throw UninitializedAFC("VarBranch<Var>::VarBranch");
   }
@@ -137,7 +152,7 @@ namespace Gecode {
   template<class Var>
   inline
   VarBranch<Var>::VarBranch(Action a, BranchTbl t)
-    : _tbl(t), _decay(1.0), _act(a) {
+    : _tbl(t), _decay(1.0), _act(a), _heap(false) {
     if (!_act)
       throw UninitializedAction("VarBranch<Var>::VarBranch");
   }
@@ -145,7 +160,7 @@ namespace Gecode {
   template<class Var>
   inline
   VarBranch<Var>::VarBranch(CHB c, BranchTbl t)
-    : _tbl(t), _decay(1.0), _chb(c) {
+    : _tbl(t), _decay(1.0), _chb(c), _heap(false) {
     if (!_chb)
       throw UninitializedCHB("VarBranch<Var>::VarBranch");
   }
@@ -153,7 +168,7 @@ namespace Gecode {
   template<class Var>
   inline
   VarBranch<Var>::VarBranch(Rnd r)
-    : _tbl(nullptr), _rnd(r), _decay(1.0) {
+    : _tbl(nullptr), _rnd(r), _decay(1.0), _heap(false) {
     if (!_rnd)
       throw UninitializedRnd("VarBranch<Var>::VarBranch");
   }
@@ -161,7 +176,7 @@ namespace Gecode {
   template<class Var>
   inline
   VarBranch<Var>::VarBranch(MeritFunction f, BranchTbl t)
-    : _tbl(t), _decay(1.0), _mf(f) {}
+    : _tbl(t), _decay(1.0), _mf(f), _heap(false) {}
 
   template<class Var>
   inline BranchTbl
@@ -223,6 +238,18 @@ namespace Gecode {
     return _mf;
   }
 
+  template<class Var>
+  inline bool
+  VarBranch<Var>::heap(void) const {
+    return _heap;
+  }
+
+  template<class Var>
+  inline void
+  VarBranch<Var>::heap(bool h) {
+    _heap=h;
+  }
+
 }
 
 // STATISTICS: kernel-branch
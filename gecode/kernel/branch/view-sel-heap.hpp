@@ -0,0 +1,443 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main author:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+namespace Gecode {
+
+  /**
+   * \brief Propagator maintaining a heap of views ordered by merit
+   *
+   * The propagator never prunes. It only uses advisors to update the
+   * merit of a view whenever its domain changes and to remove the view
+   * when it becomes assigned. Views are ordered by merit first and by
+   * position second, so the first view in the heap is exactly the view
+   * that a scan from left to right selects.
+   *
+   * The propagator is never subsumed, as the brancher owning the view
+   * selection might still be copied after all views have been assigned.
+   *
+   * \ingroup TaskBranchViewSel
+   */
+  template<class Choose, class Merit>
+  class ViewSelHeap : public Propagator {
+  public:
+    /// The view type
+    typedef typename Merit::View View;
+    /// Type of merit
+    typedef typename Merit::Val Val;
+  protected:
+    /// Advisor for the view at a position
+    class Idx : public ViewAdvisor<View> {
+    protected:
+      /// Position of the view
+      int i;
+    public:
+      /// Create advisor for view \a x at position \a i0
+      Idx(Space& home, Propagator& p, Council<Idx>& c, View x, int i0);
+      /// Constructor for cloning \a a
+      Idx(Space& home, Idx& a);
+      /// Return position of view
+      int idx(void) const;
+    };
+    /// The advisor council
+    Council<Idx> c;
+    /// How to choose
+    Choose b;
+    /// The merit object used
+    Merit m;
+    /// Number of views (all positions are smaller)
+    int n_x;
+    /// Number of views in the heap
+    int n;
+    /// The heap of view positions
+    int* h;
+    /// The position in the heap for each view (-1 if not in heap)
+    int* p;
+    /// The merit for each view in the heap
+    Val* v;
+    /// Whether the view at position \a i comes before the one at \a j
+    bool before(int i, int j) const;
+    /// Move the view at heap position \a k towards the root
+    void up(int k);
+    /// Move the view at heap position \a k towards the leaves
+    void down(int k);
+    /// Remove the view at position \a i from the heap
+    void remove(int i);
+    /// Constructor for posting
+    ViewSelHeap(Space& home, Merit& m0, ViewArray<View>& x, int s);
+    /// Constructor for cloning \a p
+    ViewSelHeap(Space& home, ViewSelHeap& vsh);
+  public:
+    /// Post propagator for unassigned views in \a x starting from \a s
+    static ViewSelHeap* post(Space& home, Merit& m,
+                             ViewArray<View>& x, int s);
+    /// Return position of best view
+    int top(void) const;
+    /// Return the copy of this propagator created during cloning
+    ViewSelHeap* copied(void) const;
+    /// Copy propagator during cloning
+    virtual Actor* copy(Space& home);
+    /// Cost function (never run)
+    virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+    /// Schedule function
+    virtual void reschedule(Space& home);
+    /// Update merit of view as its domain has changed
+    virtual ExecStatus advise(Space& home, Advisor& a, const Delta& d);
+    /// Perform propagation (never run)
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Delete propagator and return its size
+    virtual size_t dispose(Space& home);
+  };
+
+  /**
+   * \brief Choose view according to merit using a heap
+   *
+   * The heap is created on the first selection and is then maintained
+   * incrementally by a propagator of type ViewSelHeap. This is only
+   * correct if the merit of a view changes exclusively when its domain
+   * changes, that is, the merit must not depend on degree, AFC,
+   * action, CHB, or a user-defined function.
+   *
+   * Selection with a filter and tie-breaking are done by scanning.
+   *
+   * \ingroup TaskBranchViewSel
+   */
+  template<class Choose, class Merit>
+  class ViewSelChooseHeap : public ViewSelChoose<Choose,Merit> {
+  protected:
+    typedef typename ViewSelChoose<Choose,Merit>::View View;
+    typedef typename ViewSelChoose<Choose,Merit>::Var Var;
+    using ViewSelChoose<Choose,Merit>::m;
+    /// The propagator maintaining the heap (NULL if not yet created)
+    ViewSelHeap<Choose,Merit>* vsh;
+  public:
+    /// \name Initialization
+    //@{
+    /// Constructor for creation
+    ViewSelChooseHeap(Space& home, const VarBranch<Var>& vb);
+    /// Constructor for copying during cloning
+    ViewSelChooseHeap(Space& home, ViewSelChooseHeap<Choose,Merit>& vs);
+    //@}
+    /// \name View selection and tie breaking
+    //@{
+    using ViewSelChoose<Choose,Merit>::select;
+    /// Select a view from \a x starting from \a s and return its position
+    virtual int select(Space& home, ViewArray<View>& x, int s);
+    //@}
+  };
+
+  /// Select view with least merit using a heap
+  template<class Merit>
+  class ViewSelMinHeap : public ViewSelChooseHeap<ChooseMin,Merit> {
+    typedef typename ViewSelChooseHeap<ChooseMin,Merit>::View View;
+    typedef typename ViewSelChooseHeap<ChooseMin,Merit>::Var Var;
+  public:
+    /// \name Initialization
+    //@{
+    /// Constructor for initialization
+    ViewSelMinHeap(Space& home, const VarBranch<Var>& vb);
+    /// Constructor for copying during cloning
+    ViewSelMinHeap(Space& home, ViewSelMinHeap<Merit>& vs);
+    //@}
+    /// \name Resource management and cloning
+    //@{
+    /// Create copy during cloning
+    virtual ViewSel<View>* copy(Space& home);
+    //@}
+  };
+
+  /// Select view with largest merit using a heap
+  template<class Merit>
+  class ViewSelMaxHeap : public ViewSelChooseHeap<ChooseMax,Merit> {
+    typedef typename ViewSelChooseHeap<ChooseMax,Merit>::View View;
+    typedef typename ViewSelChooseHeap<ChooseMax,Merit>::Var Var;
+  public:
+    /// \name Initialization
+    //@{
+    /// Constructor for initialization
+    ViewSelMaxHeap(Space& home, const VarBranch<Var>& vb);
+    /// Constructor for copying during cloning
+    ViewSelMaxHeap(Space& home, ViewSelMaxHeap<Merit>& vs);
+    //@}
+    /// \name Resource management and cloning
+    //@{
+    /// Create copy during cloning
+    virtual ViewSel<View>* copy(Space& home);
+    //@}
+  };
+
+
+  template<class Choose, class Merit>
+  forceinline
+  ViewSelHeap<Choose,Merit>::Idx::Idx(Space& home, Propagator& p,
+                                      Council<Idx>& c, View x, int i0)
+    : ViewAdvisor<View>(home,p,c,x), i(i0) {}
+  template<class Choose, class Merit>
+  forceinline
+  ViewSelHeap<Choose,Merit>::Idx::Idx(Space& home, Idx& a)
+    : ViewAdvisor<View>(home,a), i(a.i) {}
+  template<class Choose, class Merit>
+  forceinline int
+  ViewSelHeap<Choose,Merit>::Idx::idx(void) const {
+    return i;
+  }
+
+
+  template<class Choose, class Merit>
+  forceinline bool
+  ViewSelHeap<Choose,Merit>::before(int i, int j) const {
+    return b(v[i],v[j]) || (!b(v[j],v[i]) && (i < j));
+  }
+
+  template<class Choose, class Merit>
+  forceinline void
+  ViewSelHeap<Choose,Merit>::up(int k) {
+    int i = h[k];
+    while (k > 0) {
+      int l = (k-1) >> 1;
+      if (!before(i,h[l]))
+        break;
+      h[k] = h[l]; p[h[k]] = k; k = l;
+    }
+    h[k] = i; p[i] = k;
+  }
+
+  template<class Choose, class Merit>
+  forceinline void
+  ViewSelHeap<Choose,Merit>::down(int k) {
+    int i = h[k];
+    while (true) {
+      int l = 2*k+1;
+      if (l >= n)
+        break;
+      if ((l+1 < n) && before(h[l+1],h[l]))
+        l++;
+      if (!before(h[l],i))
+        break;
+      h[k] = h[l]; p[h[k]] = k; k = l;
+    }
+    h[k] = i; p[i] = k;
+  }
+
+  template<class Choose, class Merit>
+  forceinline void
+  ViewSelHeap<Choose,Merit>::remove(int i) {
+    int k = p[i];
+    assert((k >= 0) && (h[k] == i));
+    p[i] = -1;
+    if (k < --n) {
+      // Move the last view into the hole and restore the heap
+      int j = h[n];
+      h[k] = j; p[j] = k;
+      up(k); down(p[j]);
+    }
+  }
+
+  template<class Choose, class Merit>
+  forceinline
+  ViewSelHeap<Choose,Merit>::ViewSelHeap(Space& home, Merit& m0,
+                                         ViewArray<View>& x, int s)
+    : Propagator(home), c(home), m(home,m0), n_x(x.size()), n(0),
+      h(home.alloc<int>(n_x)), p(home.alloc<int>(n_x)),
+      v(home.alloc<Val>(n_x)) {
+    for (int i=0; i<n_x; i++)
+      p[i] = -1;
+    for (int i=s; i<n_x; i++)
+      if (!x[i].assigned()) {
+        (void) new (home) Idx(home,*this,c,x[i],i);
+        v[i] = m(home,x[i],i);
+        h[n] = i; p[i] = n; n++;
+      }
+    for (int k=n/2; k--; )
+      down(k);
+    if (m.notice())
+      home.notice(*this,AP_DISPOSE);
+  }
+
+  template<class Choose, class Merit>
+  forceinline ViewSelHeap<Choose,Merit>*
+  ViewSelHeap<Choose,Merit>::post(Space& home, Merit& m,
+                                  ViewArray<View>& x, int s) {
+    return new (home) ViewSelHeap<Choose,Merit>(home,m,x,s);
+  }
+
+  template<class Choose, class Merit>
+  forceinline
+  ViewSelHeap<Choose,Merit>::ViewSelHeap(Space& home, ViewSelHeap& vsh)
+    : Propagator(home,vsh), m(home,vsh.m), n_x(vsh.n_x), n(vsh.n),
+      h(NULL), p(NULL), v(NULL) {
+    c.update(home,vsh.c);
+    // Once all views are assigned, nothing needs to be kept
+    if (n > 0) {
+      h = home.alloc<int>(n_x); p = home.alloc<int>(n_x);
+      v = home.alloc<Val>(n_x);
+      for (int k=0; k<n; k++)
+        h[k] = vsh.h[k];
+      for (int i=0; i<n_x; i++) {
+        p[i] = vsh.p[i];
+        if (p[i] >= 0)
+          v[i] = vsh.v[i];
+      }
+    }
+  }
+
+  template<class Choose, class Merit>
+  forceinline int
+  ViewSelHeap<Choose,Merit>::top(void) const {
+    assert(n > 0);
+    return h[0];
+  }
+
+  template<class Choose, class Merit>
+  forceinline ViewSelHeap<Choose,Merit>*
+  ViewSelHeap<Choose,Merit>::copied(void) const {
+    return static_cast<ViewSelHeap<Choose,Merit>*>(fwd());
+  }
+
+  template<class Choose, class Merit>
+  Actor*
+  ViewSelHeap<Choose,Merit>::copy(Space& home) {
+    return new (home) ViewSelHeap<Choose,Merit>(home,*this);
+  }
+
+  template<class Choose, class Merit>
+  PropCost
+  ViewSelHeap<Choose,Merit>::cost(const Space&, const ModEventDelta&) const {
+    return PropCost::unary(PropCost::LO);
+  }
+
+  template<class Choose, class Merit>
+  void
+  ViewSelHeap<Choose,Merit>::reschedule(Space&) {}
+
+  template<class Choose, class Merit>
+  ExecStatus
+  ViewSelHeap<Choose,Merit>::advise(Space& home, Advisor& _a, const Delta&) {
+    Idx& a = static_cast<Idx&>(_a);
+    int i = a.idx();
+    if (a.view().assigned()) {
+      remove(i);
+      return home.ES_FIX_DISPOSE(c,a);
+    }
+    Val o = v[i];
+    v[i] = m(home,a.view(),i);
+    if (b(v[i],o))
+      up(p[i]);
+    else if (b(o,v[i]))
+      down(p[i]);
+    return ES_FIX;
+  }
+
+  template<class Choose, class Merit>
+  ExecStatus
+  ViewSelHeap<Choose,Merit>::propagate(Space&, const ModEventDelta&) {
+    GECODE_NEVER;
+    return ES_FIX;
+  }
+
+  template<class Choose, class Merit>
+  size_t
+  ViewSelHeap<Choose,Merit>::dispose(Space& home) {
+    if (m.notice())
+      home.ignore(*this,AP_DISPOSE);
+    m.dispose(home);
+    c.dispose(home);
+    (void) Propagator::dispose(home);
+    return sizeof(*this);
+  }
+
+
+  template<class Choose, class Merit>
+  forceinline
+  ViewSelChooseHeap<Choose,Merit>::ViewSelChooseHeap(Space& home,
+                                                     const VarBranch<Var>& vb)
+    : ViewSelChoose<Choose,Merit>(home,vb), vsh(NULL) {}
+
+  template<class Choose, class Merit>
+  forceinline
+  ViewSelChooseHeap<Choose,Merit>::ViewSelChooseHeap
+  (Space& home, ViewSelChooseHeap<Choose,Merit>& vs)
+    : ViewSelChoose<Choose,Merit>(home,vs),
+      vsh((vs.vsh == NULL) ? NULL : vs.vsh->copied()) {}
+
+  template<class Choose, class Merit>
+  int
+  ViewSelChooseHeap<Choose,Merit>::select(Space& home, ViewArray<View>& x,
+                                          int s) {
+    if (vsh == NULL)
+      vsh = ViewSelHeap<Choose,Merit>::post(home,m,x,s);
+    assert(vsh->top() >= s);
+    return vsh->top();
+  }
+
+
+  template<class Merit>
+  forceinline
+  ViewSelMinHeap<Merit>::ViewSelMinHeap(Space& home,
+                                        const VarBranch<Var>& vb)
+    : ViewSelChooseHeap<ChooseMin,Merit>(home,vb) {}
+
+  template<class Merit>
+  forceinline
+  ViewSelMinHeap<Merit>::ViewSelMinHeap(Space& home,
+                                        ViewSelMinHeap<Merit>& vs)
+    : ViewSelChooseHeap<ChooseMin,Merit>(home,vs) {}
+
+  template<class Merit>
+  ViewSel<typename ViewSelMinHeap<Merit>::View>*
+  ViewSelMinHeap<Merit>::copy(Space& home) {
+    return new (home) ViewSelMinHeap<Merit>(home,*this);
+  }
+
+
+  template<class Merit>
+  forceinline
+  ViewSelMaxHeap<Merit>::ViewSelMaxHeap(Space& home,
+                                        const VarBranch<Var>& vb)
+    : ViewSelChooseHeap<ChooseMax,Merit>(home,vb) {}
+
+  template<class Merit>
+  forceinline
+  ViewSelMaxHeap<Merit>::ViewSelMaxHeap(Space& home,
+                                        ViewSelMaxHeap<Merit>& vs)
+    : ViewSelChooseHeap<ChooseMax,Merit>(home,vs) {}
+
+  template<class Merit>
+  ViewSel<typename ViewSelMaxHeap<Merit>::View>*
+  ViewSelMaxHeap<Merit>::copy(Space& home) {
+    return new (home) ViewSelMaxHeap<Merit>(home,*this);
+  }
+
+}
+
+// STATISTICS: kernel-branch
@@ -228,6 +228,44 @@ namespace Gecode {
     return nullptr;
   }
 
+#ifdef GECODE_PROP_PROFILE
+
+  ExecStatus
+  Space::profile(Propagator& p, const ModEventDelta& med) {
+    // Class and group must be known before a subsumed propagator is disposed
+    const std::type_info& ti = typeid(p);
+    unsigned int gid = p.group().id();
+    unsigned long long int t = PropagatorProfile::ticks();
+    ExecStatus es = p.propagate(*this,med);
+    t = PropagatorProfile::ticks() - t;
+    PropagatorProfile::Outcome o = PropagatorProfile::PO_FIX;
+    switch (es) {
+    case ES_FAILED:
+      o = PropagatorProfile::PO_FAILED; break;
+    case ES_NOFIX:
+      // Not at fixpoint only if the propagator has been rescheduled
+      if (p.u.med != 0)
+        o = PropagatorProfile::PO_NOFIX;
+      break;
+    case __ES_SUBSUMED:
+      o = PropagatorProfile::PO_SUBSUMED; break;
+    case __ES_PARTIAL:
+      o = PropagatorProfile::PO_NOFIX; break;
+    default:
+      break;
+    }
+    PropagatorProfile::record(ti,gid,t,o);
+    return es;
+  }
+
+#define GECODE_STATUS_PROPAGATE(p,med) profile(*(p),med)
+
+#else
+
+#define GECODE_STATUS_PROPAGATE(p,med) (p)->propagate(*this,med)
+
+#endif
+
   SpaceStatus
   Space::status(StatusStatistics& stat) {
     // Check whether space is failed
@@ -248,7 +286,7 @@ namespace Gecode {
         med_o = p->u.med;
         // Clear med but leave propagator in queue
         p->u.med = 0;
-        switch (p->propagate(*this,med_o)) {
+        switch (GECODE_STATUS_PROPAGATE(p,med_o)) {
         case ES_FAILED:
           goto failed;
         case ES_NOFIX:
@@ -310,7 +348,7 @@ namespace Gecode {
         med_o = p->u.med;
         // Clear med but leave propagator in queue
         p->u.med = 0;
-        switch (p->propagate(*this,med_o)) {
+        switch (GECODE_STATUS_PROPAGATE(p,med_o)) {
         case ES_FAILED:
           goto failed;
         case ES_NOFIX:
@@ -385,7 +423,7 @@ namespace Gecode {
         med_o = p->u.med;
         // Clear med but leave propagator in queue
         p->u.med = 0;
-        switch (p->propagate(*this,med_o)) {
+        switch (GECODE_STATUS_PROPAGATE(p,med_o)) {
         case ES_FAILED:
           GECODE_STATUS_TRACE(p,FAILED);
           goto failed;
@@ -506,6 +544,8 @@ namespace Gecode {
     return SS_FAILED;
   }
 
+#undef GECODE_STATUS_PROPAGATE
+
 
   const Choice*
   Space::choice(void) {
@@ -1039,6 +1039,10 @@ namespace Gecode {
     } u;
     /// A tagged pointer combining a pointer to global propagator information and whether the propagator is disabled
     void* gpi_disabled;
+#ifdef GECODE_BATCH_QUEUE
+    /// Cached cost class plus one (zero if cost must be computed)
+    unsigned int ac;
+#endif
     /// Static cast for a non-null pointer (to give a hint to optimizer)
     static Propagator* cast(ActorLink* al);
     /// Static cast for a non-null pointer (to give a hint to optimizer)
@@ -1667,6 +1671,8 @@ namespace Gecode {
    */
   class CloneStatistics {
   public:
+    /// Number of bytes of memory allocated by cloning
+    unsigned long int clone_bytes;
     /// Initialize
     CloneStatistics(void);
     /// Reset information
@@ -1932,6 +1938,11 @@ namespace Gecode {
     GECODE_KERNEL_EXPORT
     TraceRecorder* findtracerecorder(void);
 
+#ifdef GECODE_PROP_PROFILE
+    /// Execute propagator \a p for \a med and record it in the profile
+    ExecStatus profile(Propagator& p, const ModEventDelta& med);
+#endif
+
     /**
      * \brief Notice that an actor must be disposed
      *
@@ -2612,6 +2623,26 @@ namespace Gecode {
     GECODE_KERNEL_EXPORT void afc_unshare(void);
     //@}
 
+    /// \name Low-level support for memory management
+    //@{
+    /**
+     * \brief %Set minimal and maximal size of heap chunks to \a min and \a max bytes
+     *
+     * The limits are shared by all spaces cloned from this space and
+     * only apply to heap chunks requested after the call.
+     */
+    void heap_chunks(size_t min, size_t max);
+    /**
+     * \brief %Set whether large heap chunks are backed by huge pages
+     *
+     * Heap chunks of at least MemoryConfig::hcsz_huge bytes are then
+     * advised to use huge pages (only if supported by the platform).
+     * As heap chunks are at most MemoryConfig::hcsz_max bytes large by
+     * default, this is only useful together with heap_chunks().
+     */
+    void heap_hugepages(bool b);
+    //@}
+
   protected:
     /**
      * \brief Class to iterate over propagators of a space
@@ -3178,11 +3209,16 @@ namespace Gecode {
   }
 
   forceinline Space*
-  Space::clone(CloneStatistics&) const {
+  Space::clone(CloneStatistics& stat) const {
     // Clone is only const for search engines. During cloning, several data
     // structures are updated (e.g. forwarding pointers), so we have to
     // cast away the constness.
-    return const_cast<Space*>(this)->_clone();
+    Space* c = const_cast<Space*>(this)->_clone();
+    size_t a = c->mm.allocated();
+    // Remember how much memory the clone needed for the next clone
+    ssd.data().sm.hcsz_copy(a);
+    stat.clone_bytes += a;
+    return c;
   }
 
   forceinline void
@@ -3205,6 +3241,16 @@ namespace Gecode {
     ssd.data().gpi.decay(d);
   }
 
+  forceinline void
+  Space::heap_chunks(size_t min, size_t max) {
+    ssd.data().sm.hcsz_limits(min,max);
+  }
+
+  forceinline void
+  Space::heap_hugepages(bool b) {
+    ssd.data().sm.hcsz_huge(b);
+  }
+
   forceinline size_t
   Actor::dispose(Space&) {
     return sizeof(*this);
@@ -3431,6 +3477,9 @@ namespace Gecode {
                    (home.propagatorgroup().gid)) {
     u.advisors = NULL;
     assert((u.med == 0) && (u.size == 0));
+#ifdef GECODE_BATCH_QUEUE
+    ac = 0U;
+#endif
     static_cast<Space&>(home).pl.head(this);
   }
 
@@ -3439,6 +3488,10 @@ namespace Gecode {
     : gpi_disabled(p.gpi_disabled) {
     u.advisors = NULL;
     assert((u.med == 0) && (u.size == 0));
+#ifdef GECODE_BATCH_QUEUE
+    // The cost is recomputed when the copy is scheduled for the first time
+    ac = 0U;
+#endif
     // Set forwarding pointer
     p.prev(this);
   }
@@ -3450,7 +3503,8 @@ namespace Gecode {
 
   forceinline double
   Propagator::afc(void) const {
-    return const_cast<Propagator&>(*this).gpi().afc;
+    return const_cast<Propagator&>(*this).gpi().afc
+      .load(std::memory_order_relaxed);
   }
 
 #ifdef GECODE_HAS_CBS
@@ -3947,7 +4001,13 @@ namespace Gecode {
   forceinline void
   Space::enqueue(Propagator* p) {
     ActorLink::cast(p)->unlink();
+#ifdef GECODE_BATCH_QUEUE
+    if (p->ac == 0U)
+      p->ac = static_cast<unsigned int>(p->cost(*this,p->u.med).ac) + 1U;
+    ActorLink* c = &pc.p.queue[p->ac - 1U];
+#else
     ActorLink* c = &pc.p.queue[p->cost(*this,p->u.med).ac];
+#endif
     c->tail(ActorLink::cast(p));
     if (c > pc.p.active)
       pc.p.active = c;
@@ -4214,8 +4274,27 @@ namespace Gecode {
   forceinline void
   VarImp<VIC>::schedule(Space& home, Propagator& p, ModEvent me,
                         bool force) {
+#ifdef GECODE_BATCH_QUEUE
+    /*
+     * A propagator with a non-empty modification event delta is
+     * already in the queue for its cached cost and stays where it
+     * is, unless it is forcefully rescheduled: then its cost is
+     * computed again.
+     */
+    if (force) {
+      (void) VIC::med_update(p.u.med,me);
+      p.ac = 0U;
+      home.enqueue(&p);
+    } else if (p.u.med == 0) {
+      if (VIC::med_update(p.u.med,me))
+        home.enqueue(&p);
+    } else {
+      (void) VIC::med_update(p.u.med,me);
+    }
+#else
     if (VIC::med_update(p.u.med,me) || force)
       home.enqueue(&p);
+#endif
   }
 
   template<class VIC>
@@ -4633,21 +4712,24 @@ namespace Gecode {
   }
 
   forceinline void
-  CloneStatistics::reset(void) {}
+  CloneStatistics::reset(void) {
+    clone_bytes = 0;
+  }
 
   forceinline
   CloneStatistics::CloneStatistics(void) {
     reset();
   }
-  forceinline CloneStatistics
-  CloneStatistics::operator +(const CloneStatistics&) {
-    CloneStatistics s;
-    return s;
-  }
   forceinline CloneStatistics&
-  CloneStatistics::operator +=(const CloneStatistics&) {
+  CloneStatistics::operator +=(const CloneStatistics& s) {
+    clone_bytes += s.clone_bytes;
     return *this;
   }
+  forceinline CloneStatistics
+  CloneStatistics::operator +(const CloneStatistics& s) {
+    CloneStatistics t(s);
+    return t += *this;
+  }
 
   forceinline void
   CommitStatistics::reset(void) {}
@@ -35,7 +35,16 @@
 
 namespace Gecode { namespace Kernel {
 
-  Support::Mutex GPI::m;
+  void
+  GPI::rescale(Info& c) {
+    m.acquire();
+    // Another thread might have rescaled in the meantime
+    if (c.afc.load(std::memory_order_relaxed) > Kernel::Config::rescale_limit)
+      for (Block* i = b.load(std::memory_order_relaxed); i != NULL;
+           i = i->next)
+        i->rescale();
+    m.release();
+  }
 
 }}
 
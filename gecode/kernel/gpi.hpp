@@ -32,10 +32,21 @@
  */
 
 #include <cmath>
+#include <atomic>
 
 namespace Gecode { namespace Kernel {
 
-  /// Global propagator information
+  /**
+   * \brief Global propagator information
+   *
+   * The afc values are shared among all spaces (and hence all threads
+   * of a parallel search engine) that share the same information. To
+   * avoid serializing failures, a failure updates the afc value of a
+   * propagator by an atomic compare-and-swap. The mutex is only
+   * taken when allocating new information and for rescaling, which
+   * only happens when an afc value exceeds the rescale limit.
+   *
+   */
   class GPI {
   public:
     /// Class for storing propagator information
@@ -46,7 +57,7 @@ namespace Gecode { namespace Kernel {
       /// Group identifier
       unsigned int gid;
       /// The afc value
-      double afc;
+      std::atomic<double> afc;
       /// Initialize
       void init(unsigned int pid, unsigned int gid);
     };
@@ -68,17 +79,19 @@ namespace Gecode { namespace Kernel {
       void rescale(void);
     };
     /// The current block
-    Block* b;
+    std::atomic<Block*> b;
     /// The inverse decay factor
-    double invd;
+    std::atomic<double> invd;
     /// Next free propagator id
     unsigned int pid;
     /// Whether to unshare
-    bool us;
+    std::atomic<bool> us;
     /// The first block
     Block fst;
-    /// Mutex to synchronize globally shared access
-    GECODE_KERNEL_EXPORT static Support::Mutex m;
+    /// Mutex to synchronize allocation and rescaling
+    Support::Mutex m;
+    /// Rescale all afc values if \a c still exceeds the rescale limit
+    GECODE_KERNEL_EXPORT void rescale(Info& c);
   public:
     /// Initialize
     GPI(void);
@@ -101,7 +114,7 @@ namespace Gecode { namespace Kernel {
 
   forceinline void
   GPI::Info::init(unsigned int pid0, unsigned int gid0) {
-    pid=pid0; gid=gid0; afc=1.0;
+    pid=pid0; gid=gid0; afc.store(1.0,std::memory_order_relaxed);
   }
 
 
@@ -111,8 +124,12 @@ namespace Gecode { namespace Kernel {
 
   forceinline void
   GPI::Block::rescale(void) {
-    for (int i=free; i < n_info; i++)
-      info[i].afc *= Kernel::Config::rescale;
+    for (int i=free; i < n_info; i++) {
+      double o = info[i].afc.load(std::memory_order_relaxed);
+      while (!info[i].afc.compare_exchange_weak
+             (o,o * Kernel::Config::rescale,std::memory_order_relaxed))
+        ;
+    }
   }
 
 
@@ -122,48 +139,42 @@ namespace Gecode { namespace Kernel {
 
   forceinline void
   GPI::fail(Info& c) {
-    m.acquire();
-    c.afc = invd * (c.afc + 1.0);
-    if (c.afc > Kernel::Config::rescale_limit)
-      for (Block* i = b; i != NULL; i = i->next)
-        i->rescale();
-    m.release();
+    double d = invd.load(std::memory_order_relaxed);
+    double o = c.afc.load(std::memory_order_relaxed);
+    double n;
+    do {
+      n = d * (o + 1.0);
+    } while (!c.afc.compare_exchange_weak(o,n,std::memory_order_relaxed));
+    if (n > Kernel::Config::rescale_limit)
+      rescale(c);
   }
 
   forceinline double
   GPI::decay(void) const {
-    double d;
-    const_cast<GPI&>(*this).m.acquire();
-    d = 1.0 / invd;
-    const_cast<GPI&>(*this).m.release();
-    return d;
+    return 1.0 / invd.load(std::memory_order_relaxed);
   }
 
   forceinline bool
   GPI::unshare(void) {
-    bool u;
-    m.acquire();
-    u = us; us = true;
-    m.release();
-    return u;
+    return us.exchange(true,std::memory_order_acq_rel);
   }
 
   forceinline void
   GPI::decay(double d) {
-    m.acquire();
-    invd = 1.0 / d;
-    m.release();
+    invd.store(1.0 / d,std::memory_order_relaxed);
   }
 
   forceinline GPI::Info*
   GPI::allocate(unsigned int p, unsigned int gid) {
     Info* c;
     m.acquire();
-    if (b->free == 0) {
+    Block* f = b.load(std::memory_order_relaxed);
+    if (f->free == 0) {
       Block* n = new Block;
-      n->next = b; b = n;
+      n->next = f; f = n;
+      b.store(f,std::memory_order_release);
     }
-    c = &b->info[--b->free];
+    c = &f->info[--f->free];
     m.release();
     c->init(p,gid);
     return c;
@@ -173,11 +184,13 @@ namespace Gecode { namespace Kernel {
   GPI::allocate(unsigned int gid) {
     Info* c;
     m.acquire();
-    if (b->free == 0) {
+    Block* f = b.load(std::memory_order_relaxed);
+    if (f->free == 0) {
       Block* n = new Block;
-      n->next = b; b = n;
+      n->next = f; f = n;
+      b.store(f,std::memory_order_release);
     }
-    c = &b->info[--b->free];
+    c = &f->info[--f->free];
     c->init(pid++,gid);
     m.release();
     return c;
@@ -185,7 +198,7 @@ namespace Gecode { namespace Kernel {
 
   forceinline
   GPI::~GPI(void) {
-    Block* n = b;
+    Block* n = b.load(std::memory_order_acquire);
     while (n != &fst) {
       Block* d = n;
       n = n->next;
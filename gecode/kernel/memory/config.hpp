@@ -46,6 +46,15 @@ namespace Gecode { namespace Kernel {
      */
     const unsigned int n_hc_cache = 4*4;
 
+    /**
+     * \brief How many heap chunks should be cached at most per thread
+     *
+     * Chunks cached by a thread are reused without synchronization,
+     * only if the thread's cache is exhausted or full, the shared
+     * cache (see \a n_hc_cache) is used.
+     */
+    const unsigned int n_hc_cache_thread = 4;
+
     /**
      * \brief Minimal size of a heap chunk requested from the OS
      */
@@ -58,6 +67,13 @@ namespace Gecode { namespace Kernel {
      * that fits that request.
      */
     const size_t hcsz_max = 32 * 1024;
+    /**
+     * \brief Minimal size of a heap chunk to be backed by huge pages
+     *
+     * Only relevant if huge pages have been requested for a space
+     * (see Space::heap_hugepages) and the platform supports them.
+     */
+    const size_t hcsz_huge = 2 * 1024 * 1024;
     /**
      * \brief Increment ratio for chunk size
      *
@@ -73,6 +89,10 @@ namespace Gecode { namespace Kernel {
      * original space has requested less than \a hcsz_dec_ratio
      * heap chunks of the current chunk size, the current chunk size
      * for the clone is halfed.
+     *
+     * In addition, the first heap chunk of a clone is requested
+     * large enough to hold the most recent clone of a space sharing
+     * the same memory (that is, a space from the same search).
      */
     const int hcsz_dec_ratio = 8;
 
@@ -33,6 +33,10 @@
 
 #include <gecode/kernel.hh>
 
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
 namespace Gecode { namespace Kernel {
 
   Support::Mutex& SharedMemory::m(void) {
@@ -40,6 +44,31 @@ namespace Gecode { namespace Kernel {
     return _m;
   }
 
+  HeapChunkCache& SharedMemory::local(void) {
+    static thread_local HeapChunkCache _c;
+    return _c;
+  }
+
+  std::atomic<unsigned long int> SharedMemory::n_reuse(0UL);
+
+  std::atomic<unsigned long int> SharedMemory::n_wait(0UL);
+
+  void
+  SharedMemory::hugepages(HeapChunk* hc) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    // Advise only for the part that is aligned to huge pages
+    uintptr_t a = reinterpret_cast<uintptr_t>(hc);
+    uintptr_t b = (a + MemoryConfig::hcsz_huge - 1) &
+      ~static_cast<uintptr_t>(MemoryConfig::hcsz_huge - 1);
+    uintptr_t e = (a + hc->size) &
+      ~static_cast<uintptr_t>(MemoryConfig::hcsz_huge - 1);
+    if (b < e)
+      (void) madvise(reinterpret_cast<void*>(b),e-b,MADV_HUGEPAGE);
+#else
+    (void) hc;
+#endif
+  }
+
   void
   MemoryManager::alloc_refill(SharedMemory& sm, size_t sz) {
     // Try to reuse the not used memory
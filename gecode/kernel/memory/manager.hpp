@@ -38,6 +38,8 @@
  *
  */
 
+#include <atomic>
+
 namespace Gecode { namespace Kernel {
 
   /// Memory chunk with size information
@@ -56,6 +58,19 @@ namespace Gecode { namespace Kernel {
     double area[1];
   };
 
+  /// Cache of heap chunks owned by a single thread
+  class HeapChunkCache {
+  public:
+    /// How many heap chunks are available for caching
+    unsigned int n_hc;
+    /// A list of cached heap chunks
+    HeapChunk* hc;
+    /// Initialize
+    HeapChunkCache(void);
+    /// Destructor (frees all cached heap chunks)
+    ~HeapChunkCache(void);
+  };
+
   /// Shared object for several memory areas
   class SharedMemory {
   private:
@@ -68,6 +83,27 @@ namespace Gecode { namespace Kernel {
     } heap;
     /// A mutex for access
     GECODE_KERNEL_EXPORT static Support::Mutex& m(void);
+    /// Return the heap chunk cache of the calling thread
+    GECODE_KERNEL_EXPORT static HeapChunkCache& local(void);
+    /// Number of heap chunks reused from a cache
+    GECODE_KERNEL_EXPORT static std::atomic<unsigned long int> n_reuse;
+    /// Number of times a thread had to wait for access
+    GECODE_KERNEL_EXPORT static std::atomic<unsigned long int> n_wait;
+    /// Acquire mutex and count whether waiting was necessary
+    static void acquire(void);
+    /// Runtime parameters for heap chunks
+    struct {
+      /// Minimal size of a heap chunk
+      size_t min;
+      /// Maximal size of a heap chunk
+      size_t max;
+      /// Memory needed by the most recent clone
+      std::atomic<size_t> copy;
+      /// Whether large heap chunks should be backed by huge pages
+      bool huge;
+    } hcsz;
+    /// Advise the operating system to back heap chunk \a hc by huge pages
+    GECODE_KERNEL_EXPORT static void hugepages(HeapChunk* hc);
   public:
     /// Initialize
     SharedMemory(void);
@@ -79,6 +115,25 @@ namespace Gecode { namespace Kernel {
     HeapChunk* alloc(size_t s, size_t l);
     /// Free heap chunk (or cache for later)
     void free(HeapChunk* hc);
+    /// Return minimal heap chunk size
+    size_t hcsz_min(void) const;
+    /// Return maximal heap chunk size
+    size_t hcsz_max(void) const;
+    /// %Set minimal and maximal heap chunk size to \a min and \a max
+    void hcsz_limits(size_t min, size_t max);
+    /// Return memory needed by the most recent clone
+    size_t hcsz_copy(void) const;
+    /// Record that the most recent clone needed \a s bytes of memory
+    void hcsz_copy(size_t s);
+    /// %Set whether large heap chunks are backed by huge pages
+    void hcsz_huge(bool b);
+    //@}
+    /// \name Heap management statistics
+    //@
+    /// Return how many heap chunks have been reused from a cache
+    static unsigned long int reused(void);
+    /// Return how many times a thread had to wait for the shared cache
+    static unsigned long int waited(void);
     //@}
   };
 
@@ -137,14 +192,16 @@ namespace Gecode { namespace Kernel {
     /// Refill current heap area (outlined) issued by request of size \a s
     GECODE_KERNEL_EXPORT
     void alloc_refill(SharedMemory& sm, size_t s);
-    /// Do the real work for refilling
-    void alloc_fill(SharedMemory& sm, size_t s, bool first);
+    /// Do the real work for refilling, with preferred size \a p for a first chunk
+    void alloc_fill(SharedMemory& sm, size_t s, bool first, size_t p=0);
 
   public:
     /// Allocate memory of size \a s
     void* alloc(SharedMemory& sm, size_t s);
     /// Get the memory area for subscriptions
     void* subscriptions(void) const;
+    /// Return amount of heap memory allocated so far (in bytes)
+    size_t allocated(void) const;
 
   private:
     /// Start of free lists
@@ -175,15 +232,81 @@ namespace Gecode { namespace Kernel {
 
 namespace Gecode { namespace Kernel {
 
+  /*
+   * Heap chunk cache for a thread
+   *
+   */
+
+  forceinline
+  HeapChunkCache::HeapChunkCache(void)
+    : n_hc(0), hc(NULL) {}
+  forceinline
+  HeapChunkCache::~HeapChunkCache(void) {
+    while (hc != NULL) {
+      HeapChunk* t = hc;
+      hc = static_cast<HeapChunk*>(t->next);
+      Gecode::heap.rfree(t);
+    }
+  }
+
+
   /*
    * Shared memory area
    *
    */
 
+  forceinline void
+  SharedMemory::acquire(void) {
+    if (!m().tryacquire()) {
+      n_wait.fetch_add(1UL,std::memory_order_relaxed);
+      m().acquire();
+    }
+  }
+
+  forceinline unsigned long int
+  SharedMemory::reused(void) {
+    return n_reuse.load(std::memory_order_relaxed);
+  }
+  forceinline unsigned long int
+  SharedMemory::waited(void) {
+    return n_wait.load(std::memory_order_relaxed);
+  }
+
   forceinline
   SharedMemory::SharedMemory(void) {
     heap.n_hc = 0;
     heap.hc = NULL;
+    hcsz.min = MemoryConfig::hcsz_min;
+    hcsz.max = MemoryConfig::hcsz_max;
+    hcsz.copy.store(0,std::memory_order_relaxed);
+    hcsz.huge = false;
+  }
+
+  forceinline size_t
+  SharedMemory::hcsz_min(void) const {
+    return hcsz.min;
+  }
+  forceinline size_t
+  SharedMemory::hcsz_max(void) const {
+    return hcsz.max;
+  }
+  forceinline void
+  SharedMemory::hcsz_limits(size_t min, size_t max) {
+    MemoryConfig::align(min);
+    hcsz.min = std::max(min,MemoryConfig::hcsz_min);
+    hcsz.max = std::max(max,hcsz.min);
+  }
+  forceinline size_t
+  SharedMemory::hcsz_copy(void) const {
+    return hcsz.copy.load(std::memory_order_relaxed);
+  }
+  forceinline void
+  SharedMemory::hcsz_copy(size_t s) {
+    hcsz.copy.store(s,std::memory_order_relaxed);
+  }
+  forceinline void
+  SharedMemory::hcsz_huge(bool b) {
+    hcsz.huge = b;
   }
   forceinline
   SharedMemory::~SharedMemory(void) {
@@ -196,7 +319,24 @@ namespace Gecode { namespace Kernel {
 
   forceinline HeapChunk*
   SharedMemory::alloc(size_t s, size_t l) {
-    m().acquire();
+    // Try the cache of this thread first, no synchronization needed
+    {
+      HeapChunkCache& c = local();
+      while ((c.hc != NULL) && (c.hc->size < l)) {
+        c.n_hc--;
+        HeapChunk* hc = c.hc;
+        c.hc = static_cast<HeapChunk*>(hc->next);
+        Gecode::heap.rfree(hc);
+      }
+      if (c.hc != NULL) {
+        c.n_hc--;
+        HeapChunk* hc = c.hc;
+        c.hc = static_cast<HeapChunk*>(hc->next);
+        n_reuse.fetch_add(1UL,std::memory_order_relaxed);
+        return hc;
+      }
+    }
+    acquire();
     while ((heap.hc != NULL) && (heap.hc->size < l)) {
       heap.n_hc--;
       HeapChunk* hc = heap.hc;
@@ -208,17 +348,29 @@ namespace Gecode { namespace Kernel {
       assert(heap.n_hc == 0);
       hc = static_cast<HeapChunk*>(Gecode::heap.ralloc(s));
       hc->size = s;
+      if (hcsz.huge && (s >= MemoryConfig::hcsz_huge))
+        hugepages(hc);
     } else {
       heap.n_hc--;
       hc = heap.hc;
       heap.hc = static_cast<HeapChunk*>(hc->next);
+      n_reuse.fetch_add(1UL,std::memory_order_relaxed);
     }
     m().release();
     return hc;
   }
   forceinline void
   SharedMemory::free(HeapChunk* hc) {
-    m().acquire();
+    // Keep in the cache of this thread, if possible
+    {
+      HeapChunkCache& c = local();
+      if (c.n_hc < MemoryConfig::n_hc_cache_thread) {
+        c.n_hc++;
+        hc->next = c.hc; c.hc = hc;
+        return;
+      }
+    }
+    acquire();
     if (heap.n_hc == MemoryConfig::n_hc_cache) {
       Gecode::heap.rfree(hc);
     } else {
@@ -299,12 +451,18 @@ namespace Gecode { namespace Kernel {
     return &cur_hc->area[0];
   }
 
+  forceinline size_t
+  MemoryManager::allocated(void) const {
+    return requested - lsz;
+  }
+
   forceinline void
-  MemoryManager::alloc_fill(SharedMemory& sm, size_t sz, bool first) {
+  MemoryManager::alloc_fill(SharedMemory& sm, size_t sz, bool first,
+                            size_t p) {
     // Adjust current heap chunk size
     if (((requested > MemoryConfig::hcsz_inc_ratio*cur_hcsz) ||
          (sz > cur_hcsz)) &&
-        (cur_hcsz < MemoryConfig::hcsz_max) &&
+        (cur_hcsz < sm.hcsz_max()) &&
         !first) {
       cur_hcsz <<= 1;
     }
@@ -314,6 +472,9 @@ namespace Gecode { namespace Kernel {
     // Round size to next multiple of current heap chunk size
     size_t allocate = ((sz > cur_hcsz) ?
                        (((size_t) (sz / cur_hcsz)) + 1) * cur_hcsz : cur_hcsz);
+    // Prefer a larger chunk if requested
+    if (p > allocate)
+      allocate = p;
     // Request a chunk of preferably size allocate, but at least size sz
     HeapChunk* hc = sm.alloc(allocate,sz);
     start = ptr_cast<char*>(&hc->area[0]);
@@ -334,7 +495,7 @@ namespace Gecode { namespace Kernel {
 
   forceinline
   MemoryManager::MemoryManager(SharedMemory& sm)
-    : cur_hcsz(MemoryConfig::hcsz_min), requested(0), slack(NULL) {
+    : cur_hcsz(sm.hcsz_min()), requested(0), slack(NULL) {
     alloc_fill(sm,cur_hcsz,true);
     for (size_t i = 0; i<MemoryConfig::fl_size_max-MemoryConfig::fl_size_min+1;
          i++)
@@ -347,10 +508,11 @@ namespace Gecode { namespace Kernel {
     : cur_hcsz(mm.cur_hcsz), requested(0), slack(NULL) {
     MemoryConfig::align(s_sub);
     if ((mm.requested < MemoryConfig::hcsz_dec_ratio*mm.cur_hcsz) &&
-        (cur_hcsz > MemoryConfig::hcsz_min) &&
+        (cur_hcsz > sm.hcsz_min()) &&
         (s_sub*2 < cur_hcsz))
       cur_hcsz >>= 1;
-    alloc_fill(sm,cur_hcsz+s_sub,true);
+    // Try to fit the entire clone into the first chunk
+    alloc_fill(sm,cur_hcsz+s_sub,true,sm.hcsz_copy());
     // Skip the memory area at the beginning for subscriptions
     lsz   -= s_sub;
     start += s_sub;
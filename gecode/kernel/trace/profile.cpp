@@ -0,0 +1,512 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <gecode/kernel.hh>
+
+#ifdef GECODE_PROP_PROFILE
+
+#include <atomic>
+#include <map>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <cstdlib>
+
+#ifdef __GNUC__
+#include <cxxabi.h>
+#endif
+
+namespace Gecode { namespace Kernel {
+
+  /// Counters for a propagator class or group
+  class ProfileCounters {
+  public:
+    /// Number of executions
+    unsigned long long int execute;
+    /// Number of ticks
+    unsigned long long int ticks;
+    /// Number of executions per outcome
+    unsigned long long int outcome[4];
+    /// Initialize with zero
+    ProfileCounters(void);
+    /// Add counters \a c
+    ProfileCounters& operator +=(const ProfileCounters& c);
+  };
+
+  /**
+   * \brief Hash map from keys to profile counters for a single thread
+   *
+   * Only the owning thread updates the counters, other threads only
+   * read them. Hence the counters are atomic but updated without
+   * synchronization. The structure of the map (entries and their keys)
+   * is only changed while holding the profile mutex, which is also
+   * held while the map is read by other threads.
+   */
+  template<class Key>
+  class ProfileMap {
+  public:
+    /// Entry in the map
+    class Entry {
+    public:
+      /// The key (a default constructed key marks an empty entry)
+      Key key;
+      /// Number of executions
+      std::atomic<unsigned long long int> execute;
+      /// Number of ticks
+      std::atomic<unsigned long long int> ticks;
+      /// Number of executions per outcome
+      std::atomic<unsigned long long int> outcome[4];
+      /// Initialize as empty entry
+      Entry(void);
+      /// Add \a n to counter \a c (only called by the owning thread)
+      static void add(std::atomic<unsigned long long int>& c,
+                      unsigned long long int n);
+      /// Return counters
+      ProfileCounters counters(void) const;
+      /// Set all counters to zero
+      void reset(void);
+    };
+  protected:
+    /// The entries
+    Entry* e;
+    /// Number of entries (a power of two)
+    unsigned int n;
+    /// Number of used entries
+    unsigned int u;
+    /// Return entry for key \a k (might be empty)
+    Entry& find(Key k) const;
+    /// Insert new entry for key \a k
+    Entry& insert(Key k);
+  public:
+    /// Initialize
+    ProfileMap(void);
+    /// Return entry for key \a k
+    Entry& operator [](Key k);
+    /// Return number of entries
+    unsigned int size(void) const;
+    /// Return entry \a i (might be empty)
+    const Entry& entry(unsigned int i) const;
+    /// Set all counters to zero
+    void reset(void);
+    /// Destructor
+    ~ProfileMap(void);
+  };
+
+  /// Profile for a single thread
+  class ThreadProfile {
+  public:
+    /// Counters per propagator class
+    ProfileMap<const std::type_info*> classes;
+    /// Counters per propagator group
+    ProfileMap<unsigned int> groups;
+    /// Next thread profile
+    ThreadProfile* next;
+    /// Previous thread profile
+    ThreadProfile* prev;
+    /// Initialize and register
+    ThreadProfile(void);
+    /// Initialize as sentinel that is not registered
+    ThreadProfile(bool);
+    /// Unregister, counters are kept for later printing
+    ~ThreadProfile(void);
+  };
+
+  /// Shared data for propagator profiles
+  class ProfileData {
+  public:
+    /// Mutex for all access to data of other threads
+    static Support::Mutex& m(void);
+    /// Sentinel for list of profiles of running threads
+    static ThreadProfile& all(void);
+    /// Counters per class name from terminated threads
+    static std::map<std::string,ProfileCounters>& classes(void);
+    /// Counters per group from terminated threads
+    static std::map<unsigned int,ProfileCounters>& groups(void);
+    /// Return profile for current thread
+    static ThreadProfile& local(void);
+    /// Return readable name of class \a ti
+    static std::string name(const std::type_info& ti);
+    /// Collect counters from thread profile \a tp
+    static void collect(const ThreadProfile& tp,
+                        std::map<std::string,ProfileCounters>& cc,
+                        std::map<unsigned int,ProfileCounters>& gc);
+  };
+
+
+  /*
+   * Counters
+   *
+   */
+  forceinline
+  ProfileCounters::ProfileCounters(void)
+    : execute(0ULL), ticks(0ULL) {
+    for (int i=0; i<4; i++)
+      outcome[i] = 0ULL;
+  }
+
+  forceinline ProfileCounters&
+  ProfileCounters::operator +=(const ProfileCounters& c) {
+    execute += c.execute; ticks += c.ticks;
+    for (int i=0; i<4; i++)
+      outcome[i] += c.outcome[i];
+    return *this;
+  }
+
+
+  /*
+   * Maps
+   *
+   */
+  template<class Key>
+  forceinline
+  ProfileMap<Key>::Entry::Entry(void)
+    : key(), execute(0ULL), ticks(0ULL) {
+    for (int i=0; i<4; i++)
+      outcome[i].store(0ULL,std::memory_order_relaxed);
+  }
+
+  template<class Key>
+  forceinline void
+  ProfileMap<Key>::Entry::add(std::atomic<unsigned long long int>& c,
+                              unsigned long long int n) {
+    c.store(c.load(std::memory_order_relaxed) + n,
+            std::memory_order_relaxed);
+  }
+
+  template<class Key>
+  ProfileCounters
+  ProfileMap<Key>::Entry::counters(void) const {
+    ProfileCounters c;
+    c.execute = execute.load(std::memory_order_relaxed);
+    c.ticks = ticks.load(std::memory_order_relaxed);
+    for (int i=0; i<4; i++)
+      c.outcome[i] = outcome[i].load(std::memory_order_relaxed);
+    return c;
+  }
+
+  template<class Key>
+  void
+  ProfileMap<Key>::Entry::reset(void) {
+    execute.store(0ULL,std::memory_order_relaxed);
+    ticks.store(0ULL,std::memory_order_relaxed);
+    for (int i=0; i<4; i++)
+      outcome[i].store(0ULL,std::memory_order_relaxed);
+  }
+
+  /// Hash value for key \a k
+  forceinline size_t
+  profile_hash(const std::type_info* k) {
+    return (reinterpret_cast<size_t>(k) >> 4) * 2654435761U;
+  }
+  /// Hash value for key \a k
+  forceinline size_t
+  profile_hash(unsigned int k) {
+    return static_cast<size_t>(k) * 2654435761U;
+  }
+
+  template<class Key>
+  ProfileMap<Key>::ProfileMap(void)
+    : e(new Entry[16]), n(16), u(0) {}
+
+  template<class Key>
+  forceinline typename ProfileMap<Key>::Entry&
+  ProfileMap<Key>::find(Key k) const {
+    unsigned int i = static_cast<unsigned int>(profile_hash(k)) & (n-1);
+    while ((e[i].key != k) && (e[i].key != Key()))
+      i = (i+1) & (n-1);
+    return e[i];
+  }
+
+  template<class Key>
+  typename ProfileMap<Key>::Entry&
+  ProfileMap<Key>::insert(Key k) {
+    Support::Lock l(ProfileData::m());
+    if (2*(u+1) > n) {
+      // Grow the map
+      Entry* o = e;
+      unsigned int m = n;
+      e = new Entry[2*n]; n *= 2;
+      for (unsigned int i=0; i<m; i++)
+        if (o[i].key != Key()) {
+          Entry& f = find(o[i].key);
+          f.key = o[i].key;
+          ProfileCounters c = o[i].counters();
+          f.execute.store(c.execute,std::memory_order_relaxed);
+          f.ticks.store(c.ticks,std::memory_order_relaxed);
+          for (int j=0; j<4; j++)
+            f.outcome[j].store(c.outcome[j],std::memory_order_relaxed);
+        }
+      delete [] o;
+    }
+    Entry& f = find(k);
+    f.key = k; u++;
+    return f;
+  }
+
+  template<class Key>
+  forceinline typename ProfileMap<Key>::Entry&
+  ProfileMap<Key>::operator [](Key k) {
+    Entry& f = find(k);
+    return (f.key == k) ? f : insert(k);
+  }
+
+  template<class Key>
+  forceinline unsigned int
+  ProfileMap<Key>::size(void) const {
+    return n;
+  }
+
+  template<class Key>
+  forceinline const typename ProfileMap<Key>::Entry&
+  ProfileMap<Key>::entry(unsigned int i) const {
+    return e[i];
+  }
+
+  template<class Key>
+  void
+  ProfileMap<Key>::reset(void) {
+    for (unsigned int i=0; i<n; i++)
+      e[i].reset();
+  }
+
+  template<class Key>
+  ProfileMap<Key>::~ProfileMap(void) {
+    delete [] e;
+  }
+
+
+  /*
+   * Thread profiles
+   *
+   */
+  ThreadProfile::ThreadProfile(void) {
+    Support::Lock l(ProfileData::m());
+    ThreadProfile& a = ProfileData::all();
+    next = a.next; prev = &a;
+    a.next->prev = this; a.next = this;
+  }
+
+  ThreadProfile::ThreadProfile(bool)
+    : next(this), prev(this) {}
+
+  ThreadProfile::~ThreadProfile(void) {
+    Support::Lock l(ProfileData::m());
+    ProfileData::collect(*this,ProfileData::classes(),
+                         ProfileData::groups());
+    prev->next = next; next->prev = prev;
+  }
+
+
+  /*
+   * Shared data
+   *
+   */
+  Support::Mutex&
+  ProfileData::m(void) {
+    static Support::Mutex _m;
+    return _m;
+  }
+
+  ThreadProfile&
+  ProfileData::all(void) {
+    // Never deleted, as threads might terminate after static destruction
+    static ThreadProfile* _a = new ThreadProfile(true);
+    return *_a;
+  }
+
+  std::map<std::string,ProfileCounters>&
+  ProfileData::classes(void) {
+    static std::map<std::string,ProfileCounters> _c;
+    return _c;
+  }
+
+  std::map<unsigned int,ProfileCounters>&
+  ProfileData::groups(void) {
+    static std::map<unsigned int,ProfileCounters> _g;
+    return _g;
+  }
+
+  ThreadProfile&
+  ProfileData::local(void) {
+    static thread_local ThreadProfile _p;
+    return _p;
+  }
+
+  std::string
+  ProfileData::name(const std::type_info& ti) {
+#ifdef __GNUC__
+    int s = 0;
+    char* d = abi::__cxa_demangle(ti.name(),NULL,NULL,&s);
+    if (d != NULL) {
+      std::string n(d);
+      std::free(d);
+      return n;
+    }
+#endif
+    return std::string(ti.name());
+  }
+
+  void
+  ProfileData::collect(const ThreadProfile& tp,
+                       std::map<std::string,ProfileCounters>& cc,
+                       std::map<unsigned int,ProfileCounters>& gc) {
+    for (unsigned int i=0; i<tp.classes.size(); i++)
+      if (tp.classes.entry(i).key != NULL)
+        cc[name(*tp.classes.entry(i).key)] += tp.classes.entry(i).counters();
+    for (unsigned int i=0; i<tp.groups.size(); i++)
+      if (tp.groups.entry(i).key != 0U)
+        gc[tp.groups.entry(i).key] += tp.groups.entry(i).counters();
+  }
+
+}}
+
+namespace Gecode {
+
+  void
+  PropagatorProfile::record(const std::type_info& ti, unsigned int gid,
+                            unsigned long long int t, Outcome o) {
+    using namespace Kernel;
+    ThreadProfile& tp = ProfileData::local();
+    {
+      ProfileMap<const std::type_info*>::Entry& e = tp.classes[&ti];
+      e.add(e.execute,1ULL); e.add(e.ticks,t); e.add(e.outcome[o],1ULL);
+    }
+    {
+      ProfileMap<unsigned int>::Entry& e = tp.groups[gid];
+      e.add(e.execute,1ULL); e.add(e.ticks,t); e.add(e.outcome[o],1ULL);
+    }
+  }
+
+  void
+  PropagatorProfile::reset(void) {
+    using namespace Kernel;
+    Support::Lock l(ProfileData::m());
+    ProfileData::classes().clear();
+    ProfileData::groups().clear();
+    ThreadProfile& a = ProfileData::all();
+    for (ThreadProfile* tp = a.next; tp != &a; tp = tp->next) {
+      tp->classes.reset(); tp->groups.reset();
+    }
+  }
+
+  namespace {
+
+    /// Print counters \a c named \a n with total number of ticks \a t
+    void
+    print_counters(std::ostream& os, const Kernel::ProfileCounters& c,
+                   unsigned long long int t, const std::string& n) {
+      double e = (c.execute > 0ULL) ? static_cast<double>(c.execute) : 1.0;
+      os << "\t" << std::setw(7)
+         << ((t > 0ULL) ? (100.0 * c.ticks) / t : 0.0) << "%"
+         << std::setw(14) << c.ticks
+         << std::setw(12) << c.execute
+         << std::setw(7)
+         << (100.0 * c.outcome[PropagatorProfile::PO_FIX]) / e << "%"
+         << std::setw(9)
+         << (100.0 * c.outcome[PropagatorProfile::PO_SUBSUMED]) / e << "%"
+         << std::setw(10) << c.outcome[PropagatorProfile::PO_FAILED]
+         << "  " << n << std::endl;
+    }
+
+    /// Print table of counters \a m with title \a title
+    template<class Key>
+    void
+    print_table(std::ostream& os, const char* title,
+                const std::map<Key,Kernel::ProfileCounters>& m,
+                std::string (*name)(const Key&)) {
+      typedef std::pair<Key,Kernel::ProfileCounters> Item;
+      std::vector<Item> s(m.begin(),m.end());
+      unsigned long long int t = 0ULL;
+      for (const Item& i : s)
+        t += i.second.ticks;
+      std::sort(s.begin(),s.end(),[](const Item& a, const Item& b) {
+        return a.second.ticks > b.second.ticks;
+      });
+      os << "\t" << title << ":" << std::endl
+         << "\t" << std::setw(8) << "share" << std::setw(14) << "ticks"
+         << std::setw(12) << "executions"
+         << std::setw(8) << "fix" << std::setw(10) << "subsumed"
+         << std::setw(10) << "failures" << std::endl;
+      for (const Item& i : s)
+        print_counters(os,i.second,t,name(i.first));
+    }
+
+    /// Return name of class \a n
+    std::string
+    class_name(const std::string& n) {
+      return n;
+    }
+
+    /// Return name of group \a g
+    std::string
+    group_name(const unsigned int& g) {
+      if (g == PropagatorGroup::def.id())
+        return "default group";
+      std::ostringstream s;
+      s << "group " << g;
+      return s.str();
+    }
+
+  }
+
+  void
+  PropagatorProfile::print(std::ostream& os) {
+    using namespace Kernel;
+    std::map<std::string,ProfileCounters> cc;
+    std::map<unsigned int,ProfileCounters> gc;
+    {
+      Support::Lock l(ProfileData::m());
+      cc = ProfileData::classes();
+      gc = ProfileData::groups();
+      ThreadProfile& a = ProfileData::all();
+      for (ThreadProfile* tp = a.next; tp != &a; tp = tp->next)
+        ProfileData::collect(*tp,cc,gc);
+    }
+    std::ios_base::fmtflags f = os.flags();
+    std::streamsize p = os.precision();
+    char c = os.fill();
+    os << std::fixed << std::setprecision(2) << std::setfill(' ');
+    print_table(os,"propagator classes",cc,&class_name);
+    os << std::endl;
+    print_table(os,"propagator groups",gc,&group_name);
+    os.flags(f); os.precision(p); os.fill(c);
+  }
+
+}
+
+#endif
+
+// STATISTICS: kernel-trace
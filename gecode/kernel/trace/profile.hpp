@@ -0,0 +1,117 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#ifdef GECODE_PROP_PROFILE
+
+#include <typeinfo>
+#include <iostream>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define GECODE_PROP_PROFILE_RDTSC
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define GECODE_PROP_PROFILE_RDTSC
+#else
+#include <chrono>
+#endif
+
+namespace Gecode {
+
+  /**
+   * \brief Profile of propagator executions
+   *
+   * Only available if %Gecode has been built with propagator profiling
+   * (configure switch --enable-prop-profile, CMake option
+   * ENABLE_PROP_PROFILE). Then every execution of a propagator
+   * by Space::status is recorded, both for the class of the propagator
+   * and for the group it belongs to. For each class and group, the
+   * number of executions, the number of elapsed ticks (as measured by
+   * the time stamp counter where available), and how often an
+   * execution ended at a fixpoint, was not at a fixpoint, subsumed the
+   * propagator, or failed are recorded.
+   *
+   * The counters are kept per thread and are only aggregated when the
+   * profile is printed, hence all threads of a parallel search engine
+   * are taken into account.
+   *
+   * \ingroup TaskTrace
+   */
+  class PropagatorProfile {
+  public:
+    /// Outcome of a propagator execution
+    enum Outcome {
+      PO_FIX      = 0, ///< Propagator is at fixpoint
+      PO_NOFIX    = 1, ///< Propagator is not at fixpoint
+      PO_SUBSUMED = 2, ///< Propagator is subsumed
+      PO_FAILED   = 3  ///< Propagator has failed
+    };
+    /// Return current value of the tick counter
+    static unsigned long long int ticks(void);
+    /**
+     * \brief Record execution of a propagator
+     *
+     * The propagator has class \a ti, belongs to the group with
+     * identifier \a gid, took \a t ticks, and finished with outcome \a o.
+     */
+    GECODE_KERNEL_EXPORT static void
+    record(const std::type_info& ti, unsigned int gid,
+           unsigned long long int t, Outcome o);
+    /**
+     * \brief Reset all counters
+     *
+     * Should only be used while no propagators are executed.
+     */
+    GECODE_KERNEL_EXPORT static void reset(void);
+    /// Print profile sorted by ticks to \a os
+    GECODE_KERNEL_EXPORT static void print(std::ostream& os);
+  };
+
+  forceinline unsigned long long int
+  PropagatorProfile::ticks(void) {
+#ifdef GECODE_PROP_PROFILE_RDTSC
+    return __rdtsc();
+#else
+    return static_cast<unsigned long long int>
+      (std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+  }
+
+}
+
+#undef GECODE_PROP_PROFILE_RDTSC
+
+#endif
+
+// STATISTICS: kernel-trace
@@ -116,6 +116,10 @@ namespace Gecode { namespace Search {
 
     /// Minimal number of open nodes for stealing
     const unsigned int steal_limit = 3;
+    /// Number of unsuccessful steal attempts before an idle worker backs off
+    const unsigned int steal_spin = 16;
+    /// Maximal back-off delay in milliseconds for an idle worker
+    const unsigned int steal_backoff = 4;
     /// Initial delay in milliseconds for all but first worker thread
     const unsigned int initial_delay = 5;
 
@@ -144,7 +148,7 @@ namespace Gecode { namespace Search {
    * \brief %Search engine statistics
    * \ingroup TaskModelSearch
    */
-  class Statistics : public StatusStatistics {
+  class Statistics : public StatusStatistics, public CloneStatistics {
   public:
     /// Number of failed nodes in search tree
     unsigned long int fail;
@@ -156,6 +160,10 @@ namespace Gecode { namespace Search {
     unsigned long int restart;
     /// Number of no-goods posted
     unsigned long int nogood;
+    /// Number of successful attempts to steal work (parallel search)
+    unsigned long int steal_ok;
+    /// Number of unsuccessful attempts to steal work (parallel search)
+    unsigned long int steal_fail;
     /// Initialize
     Statistics(void);
     /// Reset
@@ -910,6 +918,10 @@ namespace Gecode { namespace Search {
     virtual void reset(Space* s);
     /// Return no-goods (the no-goods are empty)
     virtual NoGoods& nogoods(void);
+    /// Write checkpoint of search state to \a e (raises exception)
+    virtual void checkpoint(Archive& e) const;
+    /// Restore search state from checkpoint \a e (raises exception)
+    virtual void restore(Archive& e);
     /// Destructor
     virtual ~Engine(void);
   };
@@ -918,6 +930,31 @@ namespace Gecode { namespace Search {
 
 #include <gecode/search/engine.hpp>
 
+namespace Gecode { namespace Search {
+
+  /**
+   * \brief Write checkpoint \a e to file \a fn
+   *
+   * The checkpoint is first written to a temporary file that then
+   * replaces \a fn, so that \a fn always contains a complete
+   * checkpoint. Returns whether writing succeeded.
+   *
+   * \ingroup TaskModelSearch
+   */
+  GECODE_SEARCH_EXPORT bool
+  savecheckpoint(const char* fn, const Archive& e);
+  /**
+   * \brief Read checkpoint from file \a fn into \a e
+   *
+   * Returns whether a checkpoint could be read.
+   *
+   * \ingroup TaskModelSearch
+   */
+  GECODE_SEARCH_EXPORT bool
+  loadcheckpoint(const char* fn, Archive& e);
+
+}}
+
 namespace Gecode { namespace Search {
 
   /// Base-class for search engines
@@ -939,6 +976,30 @@ namespace Gecode { namespace Search {
     virtual Statistics statistics(void) const;
     /// Check whether engine has been stopped
     virtual bool stopped(void) const;
+    /**
+     * \brief Write checkpoint of search state to \a e
+     *
+     * The checkpoint contains the statistics, the path to the
+     * next node to be explored, and for best solution search the
+     * path to the best solution so far. All paths consist of
+     * archived choices (see Choice::archive) and refer to the
+     * root space of the engine.
+     *
+     * Throws an exception of type Search::NoCheckpoint if the
+     * engine does not support checkpoints (only sequential
+     * depth-first and branch-and-bound search do).
+     */
+    virtual void checkpoint(Archive& e) const;
+    /**
+     * \brief Restore search state from checkpoint \a e
+     *
+     * The engine must have been created for a root space that is
+     * equivalent to the root space for which the checkpoint has
+     * been written, and must not have been used for search yet.
+     * Throws an exception of type Search::IllegalCheckpoint if the
+     * checkpoint does not match.
+     */
+    virtual void restore(Archive& e);
     /// Destructor
     virtual ~Base(void);
   private:
@@ -1128,6 +1189,55 @@ namespace Gecode {
 
 #include <gecode/search/lds.hpp>
 
+namespace Gecode {
+
+  /**
+   * \brief Multi-process search engine
+   *
+   * The engine forks as many worker processes as threads are
+   * requested in the options and distributes subproblems of \a s
+   * to the workers. Subproblems and solutions are exchanged as
+   * paths of archived choices (see Choice::archive) that are
+   * replayed from the root space, which requires that all
+   * branchers support archiving their choices.
+   *
+   * If \a E performs best solution search (that is, \a E is BAB),
+   * the engine performs branch-and-bound search where better
+   * solutions are exchanged between all workers. Otherwise, it
+   * performs depth-first search. Recomputation and tracing options
+   * are ignored.
+   *
+   * The engine requires a POSIX platform, on other platforms it
+   * resorts to DFS or BAB search with threads.
+   *
+   * \ingroup TaskModelSearch
+   */
+  template<class T, template<class> class E = DFS>
+  class MPS : public Search::Base<T> {
+  public:
+    /// Initialize engine for space \a s and options \a o
+    MPS(T* s, const Search::Options& o=Search::Options::def);
+    /// Whether engine does best solution search
+    static const bool best = E<T>::best;
+  };
+
+  /**
+   * \brief Invoke multi-process search for \a s as root node and options \a o
+   *
+   * For best solution search, the best solution is returned.
+   * \ingroup TaskModelSearch
+   */
+  template<class T, template<class> class E>
+  T* mps(T* s, const Search::Options& o=Search::Options::def);
+
+  /// Return a multi-process search engine builder
+  template<class T, template<class> class E>
+  SEB mps(const Search::Options& o=Search::Options::def);
+
+}
+
+#include <gecode/search/mps.hpp>
+
 namespace Gecode {
 
   /**
@@ -1146,6 +1256,13 @@ namespace Gecode {
    * space. For more details, consult "Modeling and Programming
    * with Gecode".
    *
+   * If more than one thread and more than one asset are requested
+   * in \a o, the engine runs several restart-based workers in
+   * parallel (at most as many as there are threads). Each worker
+   * restarts independently and takes its cutoff values from the
+   * cutoff sequence in \a o, better solutions are shared among
+   * all workers.
+   *
    * \ingroup TaskModelSearch
    */
   template<class T, template<class> class E = DFS>
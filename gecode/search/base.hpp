@@ -57,6 +57,16 @@ namespace Gecode { namespace Search {
     return e->stopped();
   }
   template<class T>
+  forceinline void
+  Base<T>::checkpoint(Archive& a) const {
+    e->checkpoint(a);
+  }
+  template<class T>
+  forceinline void
+  Base<T>::restore(Archive& a) {
+    e->restore(a);
+  }
+  template<class T>
   forceinline
   Base<T>::~Base(void) {
     delete e;
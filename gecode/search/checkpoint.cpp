@@ -0,0 +1,135 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <gecode/search.hh>
+
+#include <cstdio>
+#include <string>
+
+#ifdef GECODE_HAS_UNISTD_H
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace Gecode { namespace Search {
+
+  /*
+   * A checkpoint file consists of a header followed by the words
+   * of the archive. The header contains a magic number, the format
+   * version, and the number of words.
+   *
+   */
+
+  /// Magic number for checkpoint files
+  const unsigned int ckpt_magic = 0x4b434547U;
+  /// Version of checkpoint file format
+  const unsigned int ckpt_version = 1U;
+
+  bool
+  savecheckpoint(const char* fn, const Archive& e) {
+    std::string tmp(fn); tmp += ".tmp";
+    FILE* f = fopen(tmp.c_str(), "wb");
+    if (f == NULL)
+      return false;
+    unsigned int h[3] = {ckpt_magic, ckpt_version,
+                         static_cast<unsigned int>(e.size())};
+    bool ok = (fwrite(h, sizeof(unsigned int), 3, f) == 3);
+    for (int i=0; ok && (i<e.size()); i++) {
+      unsigned int w = e[i];
+      ok = (fwrite(&w, sizeof(unsigned int), 1, f) == 1);
+    }
+    ok = (fflush(f) == 0) && ok;
+#ifdef GECODE_HAS_UNISTD_H
+    ok = ok && (fsync(fileno(f)) == 0);
+#endif
+    ok = (fclose(f) == 0) && ok;
+#ifndef GECODE_HAS_UNISTD_H
+    // Windows does not replace existing files on rename
+    if (ok)
+      (void) remove(fn);
+#endif
+    if (!ok || (rename(tmp.c_str(), fn) != 0)) {
+      (void) remove(tmp.c_str());
+      return false;
+    }
+    return true;
+  }
+
+  bool
+  loadcheckpoint(const char* fn, Archive& e) {
+#ifdef GECODE_HAS_UNISTD_H
+    int fd = open(fn, O_RDONLY);
+    if (fd < 0)
+      return false;
+    struct stat st;
+    if ((fstat(fd, &st) != 0) ||
+        (static_cast<size_t>(st.st_size) < 3*sizeof(unsigned int))) {
+      close(fd);
+      return false;
+    }
+    size_t n = static_cast<size_t>(st.st_size);
+    void* m = mmap(NULL, n, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (m == MAP_FAILED)
+      return false;
+    const unsigned int* w = static_cast<const unsigned int*>(m);
+    bool ok = (w[0] == ckpt_magic) && (w[1] == ckpt_version) &&
+      ((3+static_cast<size_t>(w[2]))*sizeof(unsigned int) == n);
+    if (ok)
+      for (unsigned int i=0; i<w[2]; i++)
+        e << w[3+i];
+    munmap(m, n);
+    return ok;
+#else
+    FILE* f = fopen(fn, "rb");
+    if (f == NULL)
+      return false;
+    unsigned int h[3];
+    bool ok = (fread(h, sizeof(unsigned int), 3, f) == 3) &&
+      (h[0] == ckpt_magic) && (h[1] == ckpt_version);
+    for (unsigned int i=0; ok && (i<h[2]); i++) {
+      unsigned int w;
+      ok = (fread(&w, sizeof(unsigned int), 1, f) == 1);
+      e << w;
+    }
+    fclose(f);
+    return ok;
+#endif
+  }
+
+}}
+
+// STATISTICS: search-other
@@ -40,6 +40,7 @@
 #include <iostream>
 #include <sstream>
 #include <vector>
+#include <deque>
 #include <cstring>
 
 #ifdef WIN32
@@ -97,7 +98,20 @@ namespace Gecode { namespace CPProfiler {
     int parent_restart_id() const;
   };
 
-  class Connector {
+  /**
+   * \brief Connector to the profiler
+   *
+   * Messages are not sent one by one but are collected in batches. If
+   * threads are available, the batches are sent by a separate thread,
+   * such that search does not block on the socket. If more than
+   * \a max_batches batches are pending, the search either waits until
+   * a batch has been sent or, if requested, node messages are dropped.
+   */
+  class Connector
+#ifdef GECODE_HAS_THREADS
+    : public Support::Terminator
+#endif
+  {
   private:
     MessageMarshalling marshalling;
     
@@ -105,12 +119,60 @@ namespace Gecode { namespace CPProfiler {
     
     int sockfd;
     bool _connected;
-    
+
+    /// Size of a batch (in bytes) before it is sent
+    static const size_t batch_size = 64 * 1024;
+    /// Maximal number of batches waiting to be sent
+    static const size_t max_batches = 64;
+    /// Whether to drop node messages rather than wait for the sender
+    const bool drop;
+    /// Number of batches that have been dropped
+    unsigned long int n_dropped;
+    /// Batch of messages currently being collected
+    std::vector<char> batch;
+#ifdef GECODE_HAS_THREADS
+    /// Thread for sending batches
+    class Sender : public Support::Runnable {
+    public:
+      /// The connector to send for
+      Connector& c;
+      /// Initialize
+      Sender(Connector& c0);
+      /// Return connector as terminator
+      virtual Support::Terminator* terminator(void) const;
+      /// Send batches until the connector is disconnected
+      virtual void run(void);
+    };
+    /// Batches waiting to be sent
+    std::deque<std::vector<char> > batches;
+    /// Whether the sender should finish after sending all batches
+    bool finish;
+    /// Mutex for access to batches
+    Support::Mutex m;
+    /// Event signalling that batches are available
+    Support::Event e_batches;
+    /// Event signalling that a batch has been taken by the sender
+    Support::Event e_space;
+    /// Event signalling that the sender has terminated
+    Support::Event e_terminated;
+    /// Send batches (executed by sender)
+    void sendBatches(void);
+    /// The sender has terminated
+    virtual void terminated(void);
+#endif
+
     static int sendall(int s, const char* buf, int* len);
-    void sendOverSocket(void);
+    /// Send current batch, \a control messages are never dropped
+    void flush(bool control);
+    void sendOverSocket(bool control);
     void sendRawMsg(const std::vector<char>& buf);
   public:    
-    Connector(unsigned int port);
+    Connector(unsigned int port, bool drop=false);
+    /// Destructor (disconnects if still connected)
+    ~Connector(void);
+
+    /// Return number of batches that have been dropped
+    unsigned long int dropped(void) const;
     
     bool connected() const;
     
@@ -208,7 +270,71 @@ namespace Gecode { namespace CPProfiler {
    * Connector
    */
   inline
-  Connector::Connector(unsigned int port) : port(port), _connected(false) {}
+  Connector::Connector(unsigned int port, bool drop0)
+    : port(port), _connected(false), drop(drop0), n_dropped(0UL)
+#ifdef GECODE_HAS_THREADS
+    , finish(false)
+#endif
+  {
+    batch.reserve(batch_size);
+  }
+
+  inline
+  Connector::~Connector(void) {
+    disconnect();
+  }
+
+  inline unsigned long int
+  Connector::dropped(void) const {
+    return n_dropped;
+  }
+
+#ifdef GECODE_HAS_THREADS
+  /*
+   * Sending batches in a separate thread
+   */
+  inline
+  Connector::Sender::Sender(Connector& c0) : c(c0) {}
+
+  inline Support::Terminator*
+  Connector::Sender::terminator(void) const {
+    return &c;
+  }
+
+  inline void
+  Connector::Sender::run(void) {
+    c.sendBatches();
+  }
+
+  inline void
+  Connector::sendBatches(void) {
+    while (true) {
+      m.acquire();
+      while (batches.empty() && !finish) {
+        m.release();
+        e_batches.wait();
+        m.acquire();
+      }
+      if (batches.empty()) {
+        // Finished and all batches have been sent
+        m.release();
+        return;
+      }
+      std::vector<char> b;
+      b.swap(batches.front());
+      batches.pop_front();
+      m.release();
+      e_space.signal();
+      int len = static_cast<int>(b.size());
+      sendall(sockfd, b.data(), &len);
+    }
+  }
+
+  inline void
+  Connector::terminated(void) {
+    e_terminated.signal();
+  }
+#endif
 
   inline bool Connector::connected() const { return _connected; }
 
@@ -248,20 +374,52 @@ namespace Gecode { namespace CPProfiler {
 
   inline void
   Connector::sendRawMsg(const std::vector<char>& buf) {
+    // Add message preceded by its size to the current batch
     uint32_t bufSize = static_cast<uint32_t>(buf.size());
-    int bufSizeLen = sizeof(uint32_t);
-    sendall(sockfd, reinterpret_cast<char*>(&bufSize), &bufSizeLen);
-    int bufSizeInt = static_cast<int>(bufSize);
-    sendall(sockfd, reinterpret_cast<const char*>(buf.data()), &bufSizeInt);
+    const char* s = reinterpret_cast<const char*>(&bufSize);
+    batch.insert(batch.end(), s, s + sizeof(uint32_t));
+    batch.insert(batch.end(), buf.begin(), buf.end());
   }
-    
+
   inline void
-  Connector::sendOverSocket(void) {
+  Connector::flush(bool control) {
+    if (batch.empty()) return;
+#ifdef GECODE_HAS_THREADS
+    m.acquire();
+    while (batches.size() >= max_batches) {
+      if (drop && !control) {
+        m.release();
+        n_dropped++;
+        batch.clear();
+        return;
+      }
+      // Wait until the sender has taken a batch
+      m.release();
+      e_space.wait();
+      m.acquire();
+    }
+    batches.push_back(std::vector<char>());
+    batches.back().swap(batch);
+    m.release();
+    e_batches.signal();
+    batch.reserve(batch_size);
+#else
+    int len = static_cast<int>(batch.size());
+    sendall(sockfd, batch.data(), &len);
+    batch.clear();
+#endif
+  }
+
+  inline void
+  Connector::sendOverSocket(bool control) {
     if (!_connected) return;
       
     std::vector<char> buf = marshalling.serialize();
       
     sendRawMsg(buf);
+    // Control messages are sent right away
+    if (control || (batch.size() >= batch_size))
+      flush(control);
   }
     
   inline void
@@ -316,6 +474,11 @@ namespace Gecode { namespace CPProfiler {
     freeaddrinfo(servinfo);  // all done with this structure
     
     _connected = true;
+
+#ifdef GECODE_HAS_THREADS
+    finish = false;
+    Support::Thread::run(new Sender(*this));
+#endif
     
     return;
   giveup:
@@ -350,7 +513,7 @@ namespace Gecode { namespace CPProfiler {
     }
     
     marshalling.makeStart(info);
-    sendOverSocket();
+    sendOverSocket(true);
   }
 
   inline void
@@ -366,17 +529,28 @@ namespace Gecode { namespace CPProfiler {
     }
     
     marshalling.makeRestart(info);
-    sendOverSocket();
+    sendOverSocket(true);
   }
   
   inline void
   Connector::done() {
     marshalling.makeDone();
-    sendOverSocket();
+    sendOverSocket(true);
   }
   
   inline void
   Connector::disconnect() {
+    if (!_connected) return;
+    flush(true);
+#ifdef GECODE_HAS_THREADS
+    // Wait until the sender has sent all batches and has terminated
+    m.acquire();
+    finish = true;
+    m.release();
+    e_batches.signal();
+    e_terminated.wait();
+#endif
+    _connected = false;
 #ifdef WIN32
     closesocket(sockfd);
 #else
@@ -395,7 +569,7 @@ namespace Gecode { namespace CPProfiler {
     if (node.nogood().valid()) msg.set_nogood(node.nogood().value());
     if (node.info().valid()) msg.set_info(node.info().value());
     
-    sendOverSocket();
+    sendOverSocket(false);
   }
 
   inline Node
@@ -48,6 +48,16 @@ namespace Gecode { namespace Search {
   Engine::nogoods(void) {
     return NoGoods::eng;
   }
+  void
+  Engine::checkpoint(Archive& e) const {
+    (void) e;
+    throw NoCheckpoint("Engine::checkpoint");
+  }
+  void
+  Engine::restore(Archive& e) {
+    (void) e;
+    throw NoCheckpoint("Engine::restore");
+  }
 
 }}
 
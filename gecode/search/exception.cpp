@@ -48,6 +48,15 @@ namespace Gecode { namespace Search {
   NoBest::NoBest(const char* l)
     : Exception(l,"Best solution search is not supported") {}
 
+  ProcessFailure::ProcessFailure(const char* l)
+    : Exception(l,"Search worker process failed") {}
+
+  NoCheckpoint::NoCheckpoint(const char* l)
+    : Exception(l,"Checkpoints are not supported") {}
+
+  IllegalCheckpoint::IllegalCheckpoint(const char* l)
+    : Exception(l,"Checkpoint does not match search engine or model") {}
+
 }}
 
 // STATISTICS: search-other
@@ -62,6 +62,24 @@ namespace Gecode { namespace Search {
     /// Initialize with location \a l
     NoBest(const char* l);
   };
+  /// %Exception: Communication with a search worker process failed
+  class GECODE_SEARCH_EXPORT ProcessFailure : public Exception {
+  public:
+    /// Initialize with location \a l
+    ProcessFailure(const char* l);
+  };
+  /// %Exception: Checkpoints are not supported
+  class GECODE_SEARCH_EXPORT NoCheckpoint : public Exception {
+  public:
+    /// Initialize with location \a l
+    NoCheckpoint(const char* l);
+  };
+  /// %Exception: Checkpoint does not match engine or model
+  class GECODE_SEARCH_EXPORT IllegalCheckpoint : public Exception {
+  public:
+    /// Initialize with location \a l
+    IllegalCheckpoint(const char* l);
+  };
   //@}
 }}
 
@@ -38,11 +38,20 @@
 #include <gecode/search/support.hh>
 
 #include <gecode/search/seq/lds.hh>
+#ifdef GECODE_HAS_THREADS
+#include <gecode/search/par/lds.hh>
+#endif
 
 namespace Gecode { namespace Search {
 
   Engine*
   ldsengine(Space* s, const Options& o) {
+#ifdef GECODE_HAS_THREADS
+    Options to = o.expand();
+    // Parallel probes are not traced
+    if ((to.threads > 1.0) && (to.d_l > 0U) && !to.tracer)
+      return new Par::LDS<NoTraceRecorder>(s,to);
+#endif
     if (o.tracer)
       return new Seq::LDS<EdgeTraceRecorder>(s,o);
     else
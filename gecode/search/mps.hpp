@@ -0,0 +1,93 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+namespace Gecode { namespace Search {
+
+  /// Create multi-process engine, performing best solution search if \a best
+  GECODE_SEARCH_EXPORT Engine*
+  mpsengine(Space* s, const Options& o, bool best);
+
+  /// A multi-process engine builder
+  template<class T, template<class> class E>
+  class MpsBuilder : public Builder {
+    using Builder::opt;
+  public:
+    /// The constructor
+    MpsBuilder(const Options& opt);
+    /// The actual build function
+    virtual Engine* operator() (Space* s) const;
+  };
+
+  template<class T, template<class> class E>
+  inline
+  MpsBuilder<T,E>::MpsBuilder(const Options& opt)
+    : Builder(opt,E<T>::best) {}
+
+  template<class T, template<class> class E>
+  Engine*
+  MpsBuilder<T,E>::operator() (Space* s) const {
+    return build<T,MPS<T,E> >(s,opt);
+  }
+
+}}
+
+namespace Gecode {
+
+  template<class T, template<class> class E>
+  inline
+  MPS<T,E>::MPS(T* s, const Search::Options& o)
+    : Search::Base<T>(Search::mpsengine(s,o,E<T>::best)) {}
+
+  template<class T, template<class> class E>
+  inline T*
+  mps(T* s, const Search::Options& o) {
+    MPS<T,E> m(s,o);
+    if (!E<T>::best)
+      return m.next();
+    T* l = NULL;
+    while (T* n = m.next()) {
+      delete l; l = n;
+    }
+    return l;
+  }
+
+  template<class T, template<class> class E>
+  SEB
+  mps(const Search::Options& o) {
+    return new Search::MpsBuilder<T,E>(o);
+  }
+
+}
+
+// STATISTICS: search-other
@@ -34,6 +34,8 @@
 #ifndef __GECODE_SEARCH_PAR_BAB_HH__
 #define __GECODE_SEARCH_PAR_BAB_HH__
 
+#include <atomic>
+
 #include <gecode/search/par/engine.hh>
 
 namespace Gecode { namespace Search { namespace Par {
@@ -71,6 +73,11 @@ namespace Gecode { namespace Search { namespace Par {
       using Engine<Tracer>::Worker::cur;
       using Engine<Tracer>::Worker::d;
       using Engine<Tracer>::Worker::idle;
+      using Engine<Tracer>::Worker::starve;
+      using Engine<Tracer>::Worker::pause;
+      using Engine<Tracer>::Worker::victim;
+      using Engine<Tracer>::Worker::stolen;
+      using Engine<Tracer>::Worker::backoff;
       using Engine<Tracer>::Worker::node;
       using Engine<Tracer>::Worker::fail;
       using Engine<Tracer>::Worker::start;
@@ -80,6 +87,8 @@ namespace Gecode { namespace Search { namespace Par {
       int mark;
       /// Best solution found so far
       Space* best;
+      /// Version of best solution known to the worker
+      unsigned long int bv;
     public:
       /// Initialize for space \a s with engine \a e
       Worker(Space* s, BAB& e);
@@ -87,8 +96,8 @@ namespace Gecode { namespace Search { namespace Par {
       BAB& engine(void) const;
       /// Start execution of worker
       virtual void run(void);
-      /// Accept better solution \a b
-      void better(Space* b);
+      /// Accept better solution if one has been announced
+      void better(void);
       /// Try to find some work
       void find(void);
       /// Reset engine to restart at space \a s
@@ -100,6 +109,8 @@ namespace Gecode { namespace Search { namespace Par {
     Worker** _worker;
     /// Best solution so far
     Space* best;
+    /// Version of best solution (incremented for each better solution)
+    std::atomic<unsigned long int> bv;
   public:
     /// Provide access to worker \a i
     Worker* worker(unsigned int i) const;
@@ -57,7 +57,9 @@ namespace Gecode { namespace Search { namespace Par {
     path.reset((s == NULL) ? 0 : ngdl);
     d = 0;
     mark = 0;
+    bv = 0UL;
     idle = false;
+    starve = 0U; pause = 0U;
     if ((s == NULL) || (s->status(*this) == SS_FAILED)) {
       delete s;
       cur = NULL;
@@ -74,12 +76,12 @@ namespace Gecode { namespace Search { namespace Par {
   template<class Tracer>
   forceinline
   BAB<Tracer>::Worker::Worker(Space* s, BAB& e)
-    : Engine<Tracer>::Worker(s,e), mark(0), best(NULL) {}
+    : Engine<Tracer>::Worker(s,e), mark(0), best(NULL), bv(0UL) {}
 
   template<class Tracer>
   forceinline
   BAB<Tracer>::BAB(Space* s, const Options& o)
-    : Engine<Tracer>(o), best(NULL) {
+    : Engine<Tracer>(o), best(NULL), bv(0UL) {
     WrapTraceRecorder::engine(o.tracer, SearchTracer::EngineType::DFS,
                               workers());
     // Create workers
@@ -103,14 +105,24 @@ namespace Gecode { namespace Search { namespace Par {
    */
   template<class Tracer>
   forceinline void
-  BAB<Tracer>::Worker::better(Space* b) {
-    m.acquire();
+  BAB<Tracer>::Worker::better(void) {
+    /*
+     * Better solutions are not pushed to the workers, instead each
+     * worker checks the version of the best solution before it
+     * performs a step. Only if the version has changed, the worker
+     * synchronizes with the engine to obtain the better solution.
+     */
+    if (bv == engine().bv.load(std::memory_order_acquire))
+      return;
+    engine().m_search.acquire();
+    bv = engine().bv.load(std::memory_order_relaxed);
+    Space* b = engine().best->clone();
+    engine().m_search.release();
     delete best;
-    best = b->clone();
+    best = b;
     mark = path.entries();
     if (cur != NULL)
       cur->constrain(*best);
-    m.release();
   }
   template<class Tracer>
   forceinline void
@@ -129,9 +141,8 @@ namespace Gecode { namespace Search { namespace Par {
     } else {
       best = s->clone();
     }
-    // Announce better solutions
-    for (unsigned int i=0U; i<workers(); i++)
-      worker(i)->better(best);
+    // Announce better solution
+    bv.fetch_add(1UL,std::memory_order_release);
     bool bs = signal();
     solutions.push(s);
     if (bs)
@@ -147,9 +158,13 @@ namespace Gecode { namespace Search { namespace Par {
   forceinline void
   BAB<Tracer>::Worker::find(void) {
     // Try to find new work (even if there is none)
-    for (unsigned int i=0U; i<engine().workers(); i++) {
+    unsigned int n = engine().workers();
+    unsigned int v = victim(n);
+    for (unsigned int i=0U; i<n; i++) {
       unsigned long int r_d = 0ul;
-      typename Engine<Tracer>::Worker* wi = engine().worker(i);
+      typename Engine<Tracer>::Worker* wi = engine().worker((v+i) % n);
+      if (wi == this)
+        continue;
       if (Space* s = wi->steal(r_d,wi->tracer,tracer)) {
         // Reset this guy
         m.acquire();
@@ -164,10 +179,13 @@ namespace Gecode { namespace Search { namespace Par {
         Statistics t = *this;
         Search::Worker::reset(r_d);
         (*this) += t;
+        stolen();
         m.release();
         return;
       }
     }
+    // No work found, back off before trying again
+    backoff();
   }
 
   /*
@@ -195,9 +213,8 @@ namespace Gecode { namespace Search { namespace Par {
       delete best;
     }
     best = b.clone();
-    // Announce better solutions
-    for (unsigned int i=0U; i<workers(); i++)
-      worker(i)->better(best);
+    // Announce better solution
+    bv.fetch_add(1UL,std::memory_order_release);
     m_search.release();
   }
 
@@ -252,6 +269,8 @@ namespace Gecode { namespace Search { namespace Par {
         // Perform exploration work
         {
           m.acquire();
+          // Take better solution into account before doing anything else
+          better();
           if (idle) {
             m.release();
             // Try to find new work
@@ -310,7 +329,7 @@ namespace Gecode { namespace Search { namespace Par {
                 {
                   Space* c;
                   if ((d == 0) || (d >= engine().opt().c_d)) {
-                    c = cur->clone();
+                    c = cur->clone(*this);
                     d = 1;
                   } else {
                     c = NULL;
@@ -367,6 +386,7 @@ namespace Gecode { namespace Search { namespace Par {
     // All workers are marked as busy again
     delete best;
     best = NULL;
+    bv.store(0UL,std::memory_order_relaxed);
     n_busy = workers();
     for (unsigned int i=1U; i<workers(); i++)
       worker(i)->reset(NULL,0);
@@ -71,6 +71,11 @@ namespace Gecode { namespace Search { namespace Par {
       using Engine<Tracer>::Worker::cur;
       using Engine<Tracer>::Worker::d;
       using Engine<Tracer>::Worker::idle;
+      using Engine<Tracer>::Worker::starve;
+      using Engine<Tracer>::Worker::pause;
+      using Engine<Tracer>::Worker::victim;
+      using Engine<Tracer>::Worker::stolen;
+      using Engine<Tracer>::Worker::backoff;
       using Engine<Tracer>::Worker::node;
       using Engine<Tracer>::Worker::fail;
       using Engine<Tracer>::Worker::start;
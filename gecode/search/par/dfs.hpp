@@ -88,6 +88,7 @@ namespace Gecode { namespace Search { namespace Par {
     path.reset((s != NULL) ? ngdl : 0);
     d = 0;
     idle = false;
+    starve = 0U; pause = 0U;
     if ((s == NULL) || (s->status(*this) == SS_FAILED)) {
       delete s;
       cur = NULL;
@@ -121,9 +122,13 @@ namespace Gecode { namespace Search { namespace Par {
   forceinline void
   DFS<Tracer>::Worker::find(void) {
     // Try to find new work (even if there is none)
-    for (unsigned int i=0U; i<engine().workers(); i++) {
+    unsigned int n = engine().workers();
+    unsigned int v = victim(n);
+    for (unsigned int i=0U; i<n; i++) {
       unsigned long int r_d = 0ul;
-      typename Engine<Tracer>::Worker* wi = engine().worker(i);
+      typename Engine<Tracer>::Worker* wi = engine().worker((v+i) % n);
+      if (wi == this)
+        continue;
       if (Space* s = wi->steal(r_d,wi->tracer,tracer)) {
         // Reset this guy
         m.acquire();
@@ -135,10 +140,13 @@ namespace Gecode { namespace Search { namespace Par {
         Statistics t = *this;
         Search::Worker::reset(r_d);
         (*this) += t;
+        stolen();
         m.release();
         return;
       }
     }
+    // No work found, back off before trying again
+    backoff();
   }
 
   /*
@@ -258,7 +266,7 @@ namespace Gecode { namespace Search { namespace Par {
                 {
                   Space* c;
                   if ((d == 0) || (d >= engine().opt().c_d)) {
-                    c = cur->clone();
+                    c = cur->clone(*this);
                     d = 1;
                   } else {
                     c = NULL;
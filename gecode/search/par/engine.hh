@@ -63,6 +63,18 @@ namespace Gecode { namespace Search { namespace Par {
       unsigned int d;
       /// Whether the worker is idle
       bool idle;
+      /// Random number generator for selecting victims
+      Support::RandomGenerator rnd;
+      /// Number of consecutive unsuccessful attempts to steal work
+      unsigned int starve;
+      /// Current back-off delay in milliseconds
+      unsigned int pause;
+      /// Return first victim to steal from among \a n workers
+      unsigned int victim(unsigned int n);
+      /// Account for successful steal (must hold mutex)
+      void stolen(void);
+      /// Account for unsuccessful attempt to steal and possibly back off
+      void backoff(void);
     public:
       /// Initialize for space \a s with engine \a e
       Worker(Space* s, Engine& e);
@@ -95,7 +95,7 @@ namespace Gecode { namespace Search { namespace Par {
   Engine<Tracer>::Worker::Worker(Space* s, Engine& e)
     : tracer(e.opt().tracer), _engine(e),
       path(s == NULL ? 0 : e.opt().nogoods_limit), d(0),
-      idle(false) {
+      idle(false), rnd(Support::hwrnd()), starve(0U), pause(0U) {
     tracer.worker();
     if (s != NULL) {
       if (s->status(*this) == SS_FAILED) {
@@ -281,6 +281,36 @@ namespace Gecode { namespace Search { namespace Par {
     return s;
   }
 
+  template<class Tracer>
+  forceinline unsigned int
+  Engine<Tracer>::Worker::victim(unsigned int n) {
+    /*
+     * Start at a random worker so that idle workers do not all
+     * compete for the low-numbered workers.
+     */
+    return rnd(n);
+  }
+
+  template<class Tracer>
+  forceinline void
+  Engine<Tracer>::Worker::stolen(void) {
+    steal_ok++;
+    starve = 0U; pause = 0U;
+  }
+
+  template<class Tracer>
+  forceinline void
+  Engine<Tracer>::Worker::backoff(void) {
+    m.acquire();
+    steal_fail++;
+    m.release();
+    if (++starve > Config::steal_spin) {
+      // Exponential back-off, bounded by the maximal delay
+      pause = (pause == 0U) ? 1U : std::min(2U*pause,Config::steal_backoff);
+      Support::Thread::sleep(pause);
+    }
+  }
+
   /*
    * Return No-Goods
    */
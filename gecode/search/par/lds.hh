@@ -0,0 +1,184 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef __GECODE_SEARCH_PAR_LDS_HH__
+#define __GECODE_SEARCH_PAR_LDS_HH__
+
+#include <gecode/search.hh>
+#include <gecode/search/support.hh>
+#include <gecode/search/seq/lds.hh>
+#include <gecode/search/par/pbs.hh>
+
+namespace Gecode { namespace Search { namespace Par {
+
+  // Forward declaration
+  template<class Tracer>
+  class LDS;
+
+  /**
+   * \brief Probe of a parallel %LDS engine run by its own thread
+   *
+   * The probe with number \a i explores the discrepancy levels
+   * \a i, \a i+n, \a i+2n, and so on where \a n is the number of
+   * probes. A probe only proceeds to its next level after all
+   * solutions of its current level have been reported.
+   */
+  template<class Tracer>
+  class LDSProbe {
+  protected:
+    /// The master engine
+    LDS<Tracer>& master;
+    /// Search options (with stop object controlled by master)
+    Options opt;
+    /// The sequential probe engine
+    Seq::Probe<Tracer> probe;
+    /// Solutions found but not yet reported for the current level
+    Support::DynamicQueue<Space*,Heap> solutions;
+    /// Current discrepancy level
+    unsigned int l;
+    /// Whether the current level has been explored entirely
+    bool finished;
+  public:
+    /// Initialize for master \a m with options \a o
+    LDSProbe(LDS<Tracer>& m, const Options& o);
+    /// Start exploring level \a l for space \a s
+    void start(Space* s, unsigned int l);
+    /// Return current discrepancy level
+    unsigned int level(void) const;
+    /// Whether the current level has been explored entirely
+    bool done(void) const;
+    /// Whether the entire search space has been explored
+    bool exhausted(void) const;
+    /// Whether the probe has been stopped
+    bool stopped(void) const;
+    /// Whether there is a solution left for the current level
+    bool empty(void) const;
+    /// Return next solution for current level
+    Space* get(void);
+    /// Return statistics
+    Statistics statistics(void) const;
+    /// Perform one run
+    void run(void);
+    /// Delete probe
+    ~LDSProbe(void);
+    /// Report solution \a s
+    void report(Space* s);
+    /// Finish run
+    void idle(void);
+  };
+
+  /**
+   * \brief Runnable for a single run of a probe
+   *
+   * The runnable is deleted by the thread that has executed it. Hence
+   * the thread does not access the probe after the run, which might
+   * have been deleted by then.
+   */
+  template<class Tracer>
+  class LDSRun : public Support::Runnable {
+  protected:
+    /// The probe to run
+    LDSProbe<Tracer>& p;
+  public:
+    /// Initialize for probe \a p
+    LDSRun(LDSProbe<Tracer>& p);
+    /// Perform one run of the probe
+    virtual void run(void);
+  };
+
+  /**
+   * \brief Parallel limited discrepancy search engine
+   *
+   * Probes for different discrepancy levels are independent and
+   * are run concurrently. Solutions are returned in the same order
+   * as by the sequential %LDS engine: a solution for the lowest
+   * discrepancy level still being explored is returned as soon as
+   * it has been found, solutions for higher levels are kept until
+   * all lower levels are done.
+   *
+   * The key invariant is that all probes are idle outside of next().
+   */
+  template<class Tracer>
+  class LDS : public Engine {
+    friend class LDSProbe<Tracer>;
+  protected:
+    /// Search options
+    Options opt;
+    /// Statistics for levels already finished
+    Statistics stat;
+    /// Root node for problem (NULL if failed)
+    Space* root;
+    /// The probes
+    LDSProbe<Tracer>** probes;
+    /// Number of probes
+    unsigned int n_probes;
+    /// Lowest discrepancy level not yet finished
+    unsigned int d;
+    /// Highest discrepancy level to explore
+    unsigned int d_max;
+    /// Whether the engine has been stopped
+    bool has_stopped;
+    /// Shared stop flag
+    volatile bool tostop;
+    /// Mutex for synchronization
+    Support::Mutex m;
+    /// Number of busy probes
+    unsigned int n_busy;
+    /// Signal that number of busy probes becomes zero
+    Support::Event e_idle;
+    /// Return probe responsible for level \a l
+    LDSProbe<Tracer>& probe(unsigned int l) const;
+    /// Start probes that still have work on their levels
+    void run(void);
+  public:
+    /// Initialize for space \a s with options \a o
+    LDS(Space* s, const Options& o);
+    /// Return next solution (NULL, if none exists or search has been stopped)
+    virtual Space* next(void);
+    /// Return statistics
+    virtual Statistics statistics(void) const;
+    /// Reset engine to restart at space \a s
+    virtual void reset(Space* s);
+    /// Check whether engine has been stopped
+    virtual bool stopped(void) const;
+    /// Destructor
+    virtual ~LDS(void);
+  };
+
+}}}
+
+#include <gecode/search/par/lds.hpp>
+
+#endif
+
+// STATISTICS: search-par
@@ -0,0 +1,301 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <algorithm>
+
+namespace Gecode { namespace Search { namespace Par {
+
+  /*
+   * The probes
+   *
+   */
+
+  template<class Tracer>
+  forceinline
+  LDSProbe<Tracer>::LDSProbe(LDS<Tracer>& m, const Options& o)
+    : master(m), opt(o), probe(opt),
+      solutions(heap), l(0U), finished(true) {
+    PortfolioStop* ps = new PortfolioStop(o.stop);
+    ps->share(&master.tostop);
+    opt.stop = ps;
+    probe.init(NULL);
+  }
+
+  template<class Tracer>
+  forceinline void
+  LDSProbe<Tracer>::start(Space* s, unsigned int l0) {
+    while (!solutions.empty())
+      delete solutions.pop();
+    probe.reset(s,l0);
+    l = l0;
+    finished = (s == NULL);
+  }
+
+  template<class Tracer>
+  forceinline unsigned int
+  LDSProbe<Tracer>::level(void) const {
+    return l;
+  }
+
+  template<class Tracer>
+  forceinline bool
+  LDSProbe<Tracer>::done(void) const {
+    return finished;
+  }
+
+  template<class Tracer>
+  forceinline bool
+  LDSProbe<Tracer>::exhausted(void) const {
+    return probe.done();
+  }
+
+  template<class Tracer>
+  forceinline bool
+  LDSProbe<Tracer>::stopped(void) const {
+    return probe.stopped();
+  }
+
+  template<class Tracer>
+  forceinline bool
+  LDSProbe<Tracer>::empty(void) const {
+    return solutions.empty();
+  }
+
+  template<class Tracer>
+  forceinline Space*
+  LDSProbe<Tracer>::get(void) {
+    return solutions.pop();
+  }
+
+  template<class Tracer>
+  forceinline Statistics
+  LDSProbe<Tracer>::statistics(void) const {
+    return probe.statistics();
+  }
+
+  template<class Tracer>
+  forceinline void
+  LDSProbe<Tracer>::report(Space* s) {
+    master.m.acquire();
+    solutions.push(s);
+    // Only a solution for the lowest level can be returned
+    if (l == master.d)
+      master.tostop = true;
+    master.m.release();
+  }
+
+  template<class Tracer>
+  forceinline void
+  LDSProbe<Tracer>::idle(void) {
+    master.m.acquire();
+    if (!probe.stopped()) {
+      finished = true;
+      if (l == master.d)
+        master.tostop = true;
+    }
+    if (--master.n_busy == 0)
+      master.e_idle.signal();
+    master.m.release();
+  }
+
+  template<class Tracer>
+  void
+  LDSProbe<Tracer>::run(void) {
+    while (Space* s = probe.next(opt))
+      report(s);
+    idle();
+  }
+
+  template<class Tracer>
+  LDSProbe<Tracer>::~LDSProbe(void) {
+    while (!solutions.empty())
+      delete solutions.pop();
+    delete opt.stop;
+  }
+
+
+  /*
+   * Running probes
+   *
+   */
+
+  template<class Tracer>
+  forceinline
+  LDSRun<Tracer>::LDSRun(LDSProbe<Tracer>& p0)
+    : Support::Runnable(true), p(p0) {}
+
+  template<class Tracer>
+  void
+  LDSRun<Tracer>::run(void) {
+    p.run();
+  }
+
+
+  /*
+   * The engine
+   *
+   */
+
+  template<class Tracer>
+  forceinline LDSProbe<Tracer>&
+  LDS<Tracer>::probe(unsigned int l) const {
+    return *probes[l % n_probes];
+  }
+
+  template<class Tracer>
+  LDS<Tracer>::LDS(Space* s, const Options& o)
+    : opt(o), root(NULL), probes(NULL), n_probes(0U), d(0U), d_max(0U),
+      has_stopped(false), tostop(false), n_busy(0U) {
+    unsigned int t = static_cast<unsigned int>(opt.threads);
+    n_probes = (opt.d_l < t) ? opt.d_l+1U : t;
+    probes = heap.alloc<LDSProbe<Tracer>*>(n_probes);
+    for (unsigned int i=0U; i<n_probes; i++)
+      probes[i] = new LDSProbe<Tracer>(*this,opt);
+    stat.node = 1;
+    if (s->status(stat) == SS_FAILED) {
+      stat.fail++;
+      if (!opt.clone)
+        delete s;
+      // Nothing to explore
+      d = 1U;
+    } else {
+      root = snapshot(s,opt);
+      d_max = opt.d_l;
+      for (unsigned int i=0U; i<n_probes; i++)
+        probes[i]->start(root->clone(),i);
+    }
+  }
+
+  template<class Tracer>
+  void
+  LDS<Tracer>::run(void) {
+    tostop = false;
+    m.acquire();
+    // Invariant: all probes are idle!
+    assert(n_busy == 0U);
+    for (unsigned int i=0U; i<n_probes; i++)
+      if (!probes[i]->done() && (probes[i]->level() <= d_max))
+        n_busy++;
+    assert(n_busy > 0U);
+    for (unsigned int i=0U; i<n_probes; i++)
+      if (!probes[i]->done() && (probes[i]->level() <= d_max))
+        Support::Thread::run(new LDSRun<Tracer>(*probes[i]));
+    m.release();
+    // Wait for all probes to become idle
+    e_idle.wait();
+    // The last probe might still hold the mutex
+    m.acquire();
+    m.release();
+  }
+
+  template<class Tracer>
+  Space*
+  LDS<Tracer>::next(void) {
+    has_stopped = false;
+    while (d <= d_max) {
+      LDSProbe<Tracer>& p = probe(d);
+      assert(p.level() == d);
+      if (!p.empty())
+        return p.get();
+      if (p.done()) {
+        // The lowest level has been explored entirely
+        if (p.exhausted())
+          d_max = d;
+        unsigned int l = d + n_probes;
+        d++;
+        if (l <= d_max) {
+          stat += p.statistics();
+          p.start(root->clone(),l);
+        }
+      } else {
+        run();
+        // The lowest level made no progress, so it must have been stopped
+        if (p.empty() && !p.done()) {
+          has_stopped = true;
+          return NULL;
+        }
+      }
+    }
+    return NULL;
+  }
+
+  template<class Tracer>
+  bool
+  LDS<Tracer>::stopped(void) const {
+    return has_stopped;
+  }
+
+  template<class Tracer>
+  Statistics
+  LDS<Tracer>::statistics(void) const {
+    assert(n_busy == 0U);
+    Statistics s(stat);
+    for (unsigned int i=0U; i<n_probes; i++)
+      s += probes[i]->statistics();
+    return s;
+  }
+
+  template<class Tracer>
+  void
+  LDS<Tracer>::reset(Space* s) {
+    assert(n_busy == 0U);
+    delete root; root = NULL;
+    stat.reset();
+    stat.node = 1;
+    has_stopped = false;
+    if ((s == NULL) || (s->status(stat) == SS_FAILED)) {
+      delete s;
+      stat.fail++;
+      d = 1U; d_max = 0U;
+      for (unsigned int i=0U; i<n_probes; i++)
+        probes[i]->start(NULL,i);
+    } else {
+      root = s;
+      d = 0U; d_max = opt.d_l;
+      for (unsigned int i=0U; i<n_probes; i++)
+        probes[i]->start(root->clone(),i);
+    }
+  }
+
+  template<class Tracer>
+  LDS<Tracer>::~LDS(void) {
+    assert(n_busy == 0U);
+    for (unsigned int i=0U; i<n_probes; i++)
+      delete probes[i];
+    heap.free<LDSProbe<Tracer>*>(probes,n_probes);
+    delete root;
+  }
+
+}}}
+
+// STATISTICS: search-par
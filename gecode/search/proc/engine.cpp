@@ -0,0 +1,552 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <gecode/search/proc/engine.hh>
+#include <gecode/search/support.hh>
+
+#ifdef GECODE_HAS_UNISTD_H
+
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+
+#include <poll.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+namespace Gecode { namespace Search { namespace Proc {
+
+  /*
+   * Messages: a header with tag and number of words, followed by words
+   *
+   */
+
+  /// Write \a n bytes from \a b to \a fd
+  static bool
+  write(int fd, const void* b, size_t n) {
+    const char* c = static_cast<const char*>(b);
+    while (n > 0) {
+      ssize_t m = ::send(fd, c, n, MSG_NOSIGNAL);
+      if (m < 0) {
+        if (errno == EINTR)
+          continue;
+        return false;
+      }
+      c += m; n -= static_cast<size_t>(m);
+    }
+    return true;
+  }
+
+  /// Read \a n bytes from \a fd into \a b
+  static bool
+  read(int fd, void* b, size_t n) {
+    char* c = static_cast<char*>(b);
+    while (n > 0) {
+      ssize_t m = ::recv(fd, c, n, 0);
+      if (m < 0) {
+        if (errno == EINTR)
+          continue;
+        return false;
+      }
+      if (m == 0)
+        return false;
+      c += m; n -= static_cast<size_t>(m);
+    }
+    return true;
+  }
+
+  bool
+  send(int fd, Tag t, const Path& p) {
+    unsigned int h[2] = {static_cast<unsigned int>(t),
+                         static_cast<unsigned int>(p.size())};
+    return write(fd, h, sizeof(h)) &&
+      (p.empty() || write(fd, &p[0], p.size()*sizeof(unsigned int)));
+  }
+
+  bool
+  receive(int fd, Tag& t, Path& p) {
+    unsigned int h[2];
+    if (!read(fd, h, sizeof(h)))
+      return false;
+    t = static_cast<Tag>(h[0]);
+    p.resize(h[1]);
+    return p.empty() || read(fd, &p[0], p.size()*sizeof(unsigned int));
+  }
+
+  Space*
+  replay(const Space& root, const Path& p, Statistics& stat) {
+    Space* s = root.clone(stat);
+    Path::size_type i = 0;
+    while (i < p.size()) {
+      unsigned int a = p[i++];
+      unsigned int n = p[i++];
+      Archive e;
+      while (n-- > 0)
+        e << p[i++];
+      const Choice* c = s->choice(e);
+      s->commit(*c,a);
+      delete c;
+    }
+    return s;
+  }
+
+  /// Append alternative \a a for choice archived in \a e to path \a p
+  static void
+  append(Path& p, unsigned int a, const Archive& e) {
+    p.push_back(a);
+    p.push_back(static_cast<unsigned int>(e.size()));
+    for (int i=0; i<e.size(); i++)
+      p.push_back(e[i]);
+  }
+
+
+  /*
+   * Worker processes
+   *
+   */
+
+  /// Worker process performing depth-first search on subproblems
+  class Worker : public Statistics {
+  protected:
+    /// Node on the stack of the worker
+    class Node {
+    public:
+      /// Space of the node
+      Space* s;
+      /// Choice of the node
+      const Choice* c;
+      /// Archived choice
+      Archive e;
+      /// Next alternative to explore
+      unsigned int a;
+      /// Length of path to the node
+      Path::size_type l;
+      /// Version of best solution the space has been constrained by
+      unsigned long int v;
+    };
+    /// Root space
+    const Space& root;
+    /// Socket connected to coordinator
+    int fd;
+    /// Whether best solution search is performed
+    bool best;
+    /// Best solution so far
+    Space* b;
+    /// Version of best solution (zero if none)
+    unsigned long int bv;
+    /// Path to the current node
+    Path path;
+    /// Number of nodes explored since last check for messages
+    unsigned int tick;
+    /// Terminate worker process
+    void exit(void);
+    /// Accept solution for path \a p as best solution, if better
+    void better(const Path& p);
+    /// Check for messages from coordinator without blocking
+    void check(void);
+    /// Explore subproblem for path \a p
+    void explore(const Path& p);
+  public:
+    /// Initialize worker
+    Worker(const Space& root, int fd, bool best);
+    /// Run worker (does not return)
+    void run(void);
+  };
+
+  forceinline
+  Worker::Worker(const Space& r, int fd0, bool best0)
+    : root(r), fd(fd0), best(best0), b(NULL), bv(0UL), tick(0U) {}
+
+  void
+  Worker::exit(void) {
+    ::close(fd);
+    ::_exit(0);
+  }
+
+  void
+  Worker::better(const Path& p) {
+    Space* s = replay(root,p,*this);
+    if (b != NULL)
+      s->constrain(*b);
+    if (s->status(*this) == SS_FAILED) {
+      delete s;
+    } else {
+      delete b; b = s; bv++;
+    }
+  }
+
+  void
+  Worker::check(void) {
+    while (true) {
+      struct pollfd pfd;
+      pfd.fd = fd; pfd.events = POLLIN; pfd.revents = 0;
+      if (::poll(&pfd, 1, 0) <= 0)
+        return;
+      Tag t; Path p;
+      if (!receive(fd,t,p) || (t != T_BEST))
+        exit();
+      better(p);
+    }
+  }
+
+  void
+  Worker::explore(const Path& p) {
+    path = p;
+    std::vector<Node> ds;
+    Space* cur = replay(root,path,*this);
+    unsigned long int cv = 0UL;
+    while (true) {
+      if (cur != NULL) {
+        if ((++tick & 31U) == 0U)
+          check();
+        node++;
+        if (best && (b != NULL) && (cv != bv)) {
+          cur->constrain(*b); cv = bv;
+        }
+        switch (cur->status(*this)) {
+        case SS_FAILED:
+          fail++;
+          delete cur;
+          break;
+        case SS_SOLVED:
+          if (!send(fd,T_SOLUTION,path))
+            exit();
+          if (best) {
+            delete b; b = cur; cv = ++bv;
+          } else {
+            delete cur;
+          }
+          break;
+        case SS_BRANCH:
+          {
+            ds.push_back(Node());
+            Node& n = ds.back();
+            n.s = cur; n.c = cur->choice(); n.a = 0U;
+            n.c->archive(n.e);
+            n.l = path.size(); n.v = cv;
+            if (ds.size() > depth)
+              depth = static_cast<unsigned long int>(ds.size());
+          }
+          break;
+        default: GECODE_NEVER;
+        }
+        cur = NULL;
+      }
+      if (ds.empty())
+        break;
+      Node& n = ds.back();
+      unsigned int a = n.a++;
+      path.resize(n.l);
+      append(path,a,n.e);
+      cv = n.v;
+      if (n.a == n.c->alternatives()) {
+        cur = n.s;
+        cur->commit(*n.c,a);
+        delete n.c;
+        ds.pop_back();
+      } else {
+        cur = n.s->clone(*this);
+        cur->commit(*n.c,a);
+      }
+    }
+  }
+
+  void
+  Worker::run(void) {
+    try {
+      while (true) {
+        Tag t; Path p;
+        if (!receive(fd,t,p))
+          exit();
+        switch (t) {
+        case T_WORK:
+          {
+            explore(p);
+            // Split counters into words
+            unsigned long long int c[5] = {node, fail, propagate, depth,
+                                           clone_bytes};
+            Path s;
+            for (int i=0; i<5; i++) {
+              s.push_back(static_cast<unsigned int>(c[i] >> 32));
+              s.push_back(static_cast<unsigned int>(c[i] & 0xffffffffULL));
+            }
+            Statistics::reset();
+            if (!send(fd,T_DONE,s))
+              exit();
+          }
+          break;
+        case T_BEST:
+          better(p);
+          break;
+        default:
+          exit();
+        }
+      }
+    } catch (...) {
+      ::_exit(1);
+    }
+  }
+
+
+  /*
+   * Coordinator
+   *
+   */
+
+  Engine::Engine(Space* s, const Options& o, bool best0)
+    : opt(o), best(best0), root(NULL), b(NULL), _stopped(false),
+      n(std::max(static_cast<unsigned int>(o.threads),1U)), n_busy(0U),
+      first(0U), pid(NULL), fd(NULL), busy(NULL) {
+    stat.node++;
+    switch (s->status(stat)) {
+    case SS_FAILED:
+      stat.fail++;
+      if (!opt.clone)
+        delete s;
+      return;
+    case SS_SOLVED:
+      root = snapshot(s,opt);
+      found.push_back(Path());
+      return;
+    case SS_BRANCH:
+      root = snapshot(s,opt);
+      expand();
+      if (!work.empty())
+        fork();
+      return;
+    default: GECODE_NEVER;
+    }
+  }
+
+  void
+  Engine::expand(void) {
+    // Spaces and paths of subproblems, all spaces are committed but not propagated
+    std::deque<std::pair<Space*,Path> > q;
+    {
+      const Choice* c = root->choice();
+      Archive e; c->archive(e);
+      for (unsigned int a=0U; a<c->alternatives(); a++) {
+        Space* s = root->clone(stat);
+        s->commit(*c,a);
+        Path p; append(p,a,e);
+        q.push_back(std::make_pair(s,p));
+      }
+      delete c;
+    }
+    // Over-partition so that workers rarely run out of work
+    while (!q.empty() && (q.size() < 4U*n)) {
+      Space* s = q.front().first;
+      Path p = q.front().second;
+      q.pop_front();
+      stat.node++;
+      switch (s->status(stat)) {
+      case SS_FAILED:
+        stat.fail++;
+        delete s;
+        break;
+      case SS_SOLVED:
+        found.push_back(p);
+        delete s;
+        break;
+      case SS_BRANCH:
+        {
+          const Choice* c = s->choice();
+          Archive e; c->archive(e);
+          for (unsigned int a=0U; a<c->alternatives(); a++) {
+            Space* t = (a+1U < c->alternatives()) ? s->clone(stat) : s;
+            t->commit(*c,a);
+            Path tp(p); append(tp,a,e);
+            q.push_back(std::make_pair(t,tp));
+          }
+          delete c;
+        }
+        break;
+      default: GECODE_NEVER;
+      }
+    }
+    while (!q.empty()) {
+      delete q.front().first;
+      work.push_back(q.front().second);
+      q.pop_front();
+    }
+  }
+
+  void
+  Engine::fork(void) {
+    pid = heap.alloc<pid_t>(n);
+    fd = heap.alloc<int>(n);
+    busy = heap.alloc<bool>(n);
+    for (unsigned int i=0U; i<n; i++) {
+      int sv[2];
+      if (::socketpair(AF_UNIX, SOCK_STREAM, 0, sv) != 0)
+        throw ProcessFailure("Proc::Engine::fork");
+      pid_t p = ::fork();
+      if (p < 0) {
+        ::close(sv[0]); ::close(sv[1]);
+        throw ProcessFailure("Proc::Engine::fork");
+      }
+      if (p == 0) {
+        // Child: only keep the socket to the coordinator
+        for (unsigned int j=0U; j<i; j++)
+          ::close(fd[j]);
+        ::close(sv[0]);
+        Worker w(*root,sv[1],best);
+        w.run();
+        GECODE_NEVER;
+      }
+      ::close(sv[1]);
+      pid[i] = p; fd[i] = sv[0]; busy[i] = false;
+    }
+  }
+
+  Space*
+  Engine::solution(const Path& p, unsigned int w) {
+    Space* s = replay(*root,p,stat);
+    if (best && (b != NULL))
+      s->constrain(*b);
+    if (s->status(stat) == SS_FAILED) {
+      delete s;
+      return NULL;
+    }
+    if (best) {
+      delete b;
+      b = s->clone();
+      for (unsigned int i=0U; i<n; i++)
+        if ((i != w) && (pid != NULL) && !send(fd[i],T_BEST,p))
+          throw ProcessFailure("Proc::Engine::solution");
+    }
+    return s;
+  }
+
+  Space*
+  Engine::next(void) {
+    _stopped = false;
+    while (true) {
+      while (!found.empty()) {
+        Path p = found.front();
+        found.pop_front();
+        if (Space* s = solution(p,n))
+          return s;
+      }
+      for (unsigned int i=0U; (i<n) && !work.empty(); i++)
+        if (!busy[i]) {
+          if (!send(fd[i],T_WORK,work.front()))
+            throw ProcessFailure("Proc::Engine::next");
+          work.pop_front();
+          busy[i] = true; n_busy++;
+        }
+      if (n_busy == 0U)
+        return NULL;
+      if ((opt.stop != NULL) && opt.stop->stop(statistics(),opt)) {
+        _stopped = true;
+        return NULL;
+      }
+      Region r;
+      struct pollfd* pfd = r.alloc<struct pollfd>(n);
+      for (unsigned int i=0U; i<n; i++) {
+        pfd[i].fd = fd[i]; pfd[i].events = POLLIN; pfd[i].revents = 0;
+      }
+      if (::poll(pfd, n, -1) < 0) {
+        if (errno == EINTR)
+          continue;
+        throw ProcessFailure("Proc::Engine::next");
+      }
+      // Serve workers in round-robin order
+      for (unsigned int k=0U; k<n; k++) {
+        unsigned int i = (first + k) % n;
+        if (pfd[i].revents == 0)
+          continue;
+        first = i + 1U;
+        Tag t; Path p;
+        if (!receive(fd[i],t,p))
+          throw ProcessFailure("Proc::Engine::next");
+        if (t == T_SOLUTION) {
+          if (Space* s = solution(p,i))
+            return s;
+        } else if (t == T_DONE) {
+          unsigned long int c[5];
+          for (int j=0; j<5; j++)
+            c[j] = static_cast<unsigned long int>
+              ((static_cast<unsigned long long int>(p[2*j]) << 32) |
+               static_cast<unsigned long long int>(p[2*j+1]));
+          stat.node += c[0]; stat.fail += c[1]; stat.propagate += c[2];
+          stat.depth = std::max(stat.depth,c[3]);
+          stat.clone_bytes += c[4];
+          busy[i] = false; n_busy--;
+        } else {
+          throw ProcessFailure("Proc::Engine::next");
+        }
+        break;
+      }
+    }
+    GECODE_NEVER;
+    return NULL;
+  }
+
+  Statistics
+  Engine::statistics(void) const {
+    return stat;
+  }
+
+  bool
+  Engine::stopped(void) const {
+    return _stopped;
+  }
+
+  Engine::~Engine(void) {
+    if (pid != NULL) {
+      for (unsigned int i=0U; i<n; i++) {
+        ::close(fd[i]);
+        ::kill(pid[i], SIGKILL);
+        int status;
+        while ((::waitpid(pid[i], &status, 0) < 0) && (errno == EINTR)) {}
+      }
+      heap.free<pid_t>(pid,n);
+      heap.free<int>(fd,n);
+      heap.free<bool>(busy,n);
+    }
+    delete root;
+    delete b;
+  }
+
+}}}
+
+#endif
+
+// STATISTICS: search-proc
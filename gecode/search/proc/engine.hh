@@ -0,0 +1,137 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#ifndef __GECODE_SEARCH_PROC_ENGINE_HH__
+#define __GECODE_SEARCH_PROC_ENGINE_HH__
+
+#include <gecode/search.hh>
+
+#include <vector>
+#include <deque>
+
+#include <sys/types.h>
+
+namespace Gecode { namespace Search { namespace Proc {
+
+  /**
+   * \brief Commit path from the root space
+   *
+   * For each level the path contains the number of the alternative,
+   * the number of words of the archived choice (see Choice::archive),
+   * and the words themselves.
+   */
+  typedef std::vector<unsigned int> Path;
+
+  /// Tags of messages exchanged between coordinator and workers
+  enum Tag {
+    T_WORK,     ///< Explore subproblem (coordinator to worker)
+    T_BEST,     ///< New best solution (both directions)
+    T_EXIT,     ///< Terminate worker (coordinator to worker)
+    T_SOLUTION, ///< Solution found (worker to coordinator)
+    T_DONE      ///< Subproblem explored, includes statistics
+  };
+
+  /// Send message with tag \a t and words \a p to \a fd
+  bool send(int fd, Tag t, const Path& p);
+  /// Receive message from \a fd into tag \a t and words \a p
+  bool receive(int fd, Tag& t, Path& p);
+  /// Replay path \a p on a clone of \a root
+  Space* replay(const Space& root, const Path& p, Statistics& stat);
+
+  /**
+   * \brief Multi-process search engine
+   *
+   * The coordinator expands the root space breadth-first until
+   * there are enough subproblems, forks one worker process per
+   * thread requested and hands out the subproblems as commit paths
+   * over Unix domain sockets. Workers run depth-first search
+   * (branch-and-bound, if \a best is true) on the subproblems and
+   * report solutions as paths, which the coordinator replays. For
+   * best solution search, every better solution is broadcast as a
+   * path to all workers.
+   */
+  class Engine : public Search::Engine {
+  protected:
+    /// Search options
+    Options opt;
+    /// Whether best solution search is performed
+    bool best;
+    /// Root space (NULL if failed)
+    Space* root;
+    /// Best solution so far
+    Space* b;
+    /// Statistics of coordinator and finished subproblems
+    Statistics stat;
+    /// Whether search has been stopped
+    bool _stopped;
+    /// Number of workers
+    unsigned int n;
+    /// Number of busy workers
+    unsigned int n_busy;
+    /// Worker to check first for messages
+    unsigned int first;
+    /// Process identifiers of workers
+    pid_t* pid;
+    /// Sockets connected to workers
+    int* fd;
+    /// Whether worker is busy
+    bool* busy;
+    /// Subproblems not yet handed out
+    std::deque<Path> work;
+    /// Solutions found while expanding the root
+    std::deque<Path> found;
+    /// Expand root into subproblems
+    void expand(void);
+    /// Fork workers
+    void fork(void);
+    /// Process solution path \a p reported by worker \a w
+    Space* solution(const Path& p, unsigned int w);
+  public:
+    /// Initialize for space \a s with options \a o
+    Engine(Space* s, const Options& o, bool best);
+    /// Return next solution (NULL, if none exists or search has been stopped)
+    virtual Space* next(void);
+    /// Return statistics
+    virtual Statistics statistics(void) const;
+    /// Check whether engine has been stopped
+    virtual bool stopped(void) const;
+    /// Destructor
+    virtual ~Engine(void);
+  };
+
+}}}
+
+#endif
+
+// STATISTICS: search-proc
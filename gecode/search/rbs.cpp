@@ -50,4 +50,90 @@ namespace Gecode { namespace Search { namespace Seq {
 
 }}}
 
+#ifdef GECODE_HAS_THREADS
+
+#include <gecode/search/par/pbs.hh>
+
+namespace Gecode { namespace Search { namespace Par {
+
+  /**
+   * \brief Cutoff object for a worker of a parallel restart engine
+   *
+   * All workers share a single cutoff sequence: each time a worker
+   * restarts it takes the next value from the shared sequence. The
+   * last worker deleted also deletes the shared cutoff object.
+   */
+  class SharedCutoff : public Cutoff {
+  protected:
+    /// Data shared among all workers
+    class Shared : public HeapAllocated {
+    public:
+      /// The shared cutoff sequence
+      Cutoff* co;
+      /// Number of workers still referring to the shared data
+      unsigned int n;
+      /// Mutex for synchronizing access
+      Support::Mutex m;
+      /// Initialize with cutoff \a co0 shared by \a n0 workers
+      Shared(Cutoff* co0, unsigned int n0) : co(co0), n(n0) {}
+    };
+    /// The shared data
+    Shared* s;
+    /// The current cutoff value of this worker
+    unsigned long int cur;
+  public:
+    /// Initialize with shared data \a s0 and first value \a c
+    SharedCutoff(Shared* s0, unsigned long int c) : s(s0), cur(c) {}
+    /// Return the current cutoff value
+    virtual unsigned long int operator ()(void) const {
+      return cur;
+    }
+    /// Take the next value from the shared sequence
+    virtual unsigned long int operator ++(void) {
+      s->m.acquire();
+      cur = ++(*s->co);
+      s->m.release();
+      return cur;
+    }
+    /// Create \a n cutoff objects in \a cos sharing sequence \a co
+    static void create(Cutoff* co, Cutoff** cos, unsigned int n) {
+      Shared* s = new Shared(co,n);
+      for (unsigned int i=0U; i<n; i++)
+        cos[i] = new SharedCutoff(s, (i == 0U) ? (*co)() : ++(*co));
+    }
+    /// Delete and possibly delete shared cutoff sequence
+    virtual ~SharedCutoff(void) {
+      s->m.acquire();
+      bool d = (--s->n == 0U);
+      s->m.release();
+      if (d) {
+        delete s->co;
+        delete s;
+      }
+    }
+  };
+
+  Stop*
+  rbsstop(Stop* so) {
+    return new PortfolioStop(so);
+  }
+
+  void
+  rbscutoff(Cutoff* co, Cutoff** cos, unsigned int n) {
+    SharedCutoff::create(co,cos,n);
+  }
+
+  Engine*
+  rbsengine(Engine** workers, Stop** stops, unsigned int n,
+            const Statistics& stat, bool best) {
+    if (best)
+      return new PBS<CollectBest>(workers,stops,n,stat);
+    else
+      return new PBS<CollectAll>(workers,stops,n,stat);
+  }
+
+}}}
+
+#endif
+
 // STATISTICS: search-seq
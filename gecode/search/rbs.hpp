@@ -33,6 +33,9 @@
  *
  */
 
+#include <cmath>
+#include <algorithm>
+
 #include <gecode/search/support.hh>
 #include <gecode/search/seq/dead.hh>
 
@@ -50,8 +53,82 @@ namespace Gecode { namespace Search { namespace Seq {
 
 }}}
 
+#ifdef GECODE_HAS_THREADS
+
+namespace Gecode { namespace Search { namespace Par {
+
+  /// Create stop object for a worker of a parallel restart engine
+  GECODE_SEARCH_EXPORT Stop*
+  rbsstop(Stop* so);
+
+  /// Initialize \a n cutoff objects \a cos that share the sequence of \a co
+  GECODE_SEARCH_EXPORT void
+  rbscutoff(Cutoff* co, Cutoff** cos, unsigned int n);
+
+  /// Create parallel restart engine from \a n restart engines
+  GECODE_SEARCH_EXPORT Engine*
+  rbsengine(Engine** workers, Stop** stops, unsigned int n,
+            const Statistics& stat, bool best);
+
+}}}
+
+#endif
+
 namespace Gecode { namespace Search {
 
+#ifdef GECODE_HAS_THREADS
+
+  /**
+   * \brief Create parallel restart engine for master space \a master
+   *
+   * Each worker is a sequential restart engine with its own master
+   * space that restarts independently of the other workers. The
+   * cutoff values for the workers are taken from the shared cutoff
+   * sequence in \a m_opt. Better solutions are announced to all
+   * workers.
+   */
+  template<class T, template<class> class E>
+  Engine*
+  rbspar(Space* master, const Statistics& stat, const Options& m_opt) {
+    Region r;
+
+    // Limit the number of workers to the number of threads
+    unsigned int n = std::min(static_cast<unsigned int>(m_opt.threads),
+                              m_opt.assets);
+    Options w_opt(m_opt);
+    // Redistribute additional threads to the workers' engines
+    w_opt.threads = floor(m_opt.threads / static_cast<double>(n));
+
+    WrapTraceRecorder::engine(w_opt.tracer,
+                              SearchTracer::EngineType::PBS, n);
+
+    Engine** workers = r.alloc<Engine*>(n);
+    Stop** stops = r.alloc<Stop*>(n);
+    Cutoff** cos = r.alloc<Cutoff*>(n);
+    Par::rbscutoff(m_opt.cutoff,cos,n);
+
+    for (unsigned int i=0U; i<n; i++) {
+      stops[i] = Par::rbsstop(m_opt.stop);
+      Options e_opt(w_opt);
+      e_opt.clone = false;
+      e_opt.stop  = Seq::rbsstop(stops[i]);
+      WrapTraceRecorder::engine(e_opt.tracer,
+                                SearchTracer::EngineType::RBS, 1U);
+      Space* w_master = (i == n-1) ? master : master->clone();
+      Space* slave = w_master->clone();
+      MetaInfo mi(0,0,0,NULL,NoGoods::eng);
+      slave->slave(mi);
+      w_opt.cutoff = cos[i];
+      workers[i] = Seq::rbsengine(w_master,e_opt.stop,
+                                  build<T,E>(slave,e_opt),
+                                  Statistics(),w_opt,E<T>::best);
+    }
+
+    return Par::rbsengine(workers,stops,n,stat,E<T>::best);
+  }
+
+#endif
+
   /// A RBS engine builder
   template<class T, template<class> class E>
   class RbsBuilder : public Builder {
@@ -85,6 +162,20 @@ namespace Gecode {
       throw Search::UninitializedCutoff("RBS::RBS");
     Search::Options e_opt(m_opt.expand());
     Search::Statistics stat;
+#ifdef GECODE_HAS_THREADS
+    if ((e_opt.threads > 1.0) && (e_opt.assets > 1U)) {
+      if (s->status(stat) == SS_FAILED) {
+        stat.fail++;
+        if (!m_opt.clone)
+          delete s;
+        e = Search::Seq::dead(e_opt, stat);
+      } else {
+        Space* master = m_opt.clone ? s->clone() : s;
+        e = Search::rbspar<T,E>(master,stat,e_opt);
+      }
+      return;
+    }
+#endif
     e_opt.clone = false;
     e_opt.stop  = Search::Seq::rbsstop(m_opt.stop);
     Search::WrapTraceRecorder::engine(e_opt.tracer,
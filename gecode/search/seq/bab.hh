@@ -63,6 +63,8 @@ namespace Gecode { namespace Search { namespace Seq {
     int mark;
     /// Best solution found so far
     Space* best;
+    /// Path to best solution (empty if unknown)
+    Archive bp;
   public:
     /// Initialize with space \a s and search options \a o
     BAB(Space* s, const Options& o);
@@ -76,6 +78,10 @@ namespace Gecode { namespace Search { namespace Seq {
     void reset(Space* s);
     /// Return no-goods
     NoGoods& nogoods(void);
+    /// Write checkpoint of search state to \a e
+    void checkpoint(Archive& e) const;
+    /// Restore search state from checkpoint \a e
+    void restore(Archive& e);
     /// Destructor
     ~BAB(void);
   };
@@ -118,6 +118,8 @@ namespace Gecode { namespace Search { namespace Seq {
           (void) cur->choice();
           delete best;
           best = cur;
+          bp = Archive();
+          path.checkpoint(bp);
           cur = NULL;
           path.next();
           mark = path.entries();
@@ -127,7 +129,7 @@ namespace Gecode { namespace Search { namespace Seq {
         {
           Space* c;
           if ((d == 0) || (d >= opt.c_d)) {
-            c = cur->clone();
+            c = cur->clone(*this);
             d = 1;
           } else {
             c = NULL;
@@ -168,6 +170,7 @@ namespace Gecode { namespace Search { namespace Seq {
         delete best;
     }
     best = b.clone();
+    bp = Archive();
     if (cur != NULL)
       cur->constrain(b);
     mark = path.entries();
@@ -179,6 +182,7 @@ namespace Gecode { namespace Search { namespace Seq {
     tracer.round();
     delete best;
     best = NULL;
+    bp = Archive();
     path.reset();
     d = 0;
     mark = 0;
@@ -198,6 +202,63 @@ namespace Gecode { namespace Search { namespace Seq {
     return path;
   }
 
+  template<class Tracer>
+  forceinline void
+  BAB<Tracer>::checkpoint(Archive& e) const {
+    e << SearchTracer::EngineType::BAB;
+    Search::checkpoint(e,*this);
+    e << bp.size();
+    for (int i=0; i<bp.size(); i++)
+      e << bp[i];
+    // Whether there are nodes left to explore
+    bool open = (cur != NULL) || !path.empty();
+    e << open;
+    if (open)
+      path.checkpoint(e);
+  }
+
+  template<class Tracer>
+  forceinline void
+  BAB<Tracer>::restore(Archive& e) {
+    int t; e >> t;
+    if (t != SearchTracer::EngineType::BAB)
+      throw IllegalCheckpoint("BAB::restore");
+    Search::restore(e,*this);
+    int n; e >> n;
+    bp = Archive();
+    while (n-- > 0) {
+      unsigned int w; e >> w; bp << w;
+    }
+    bool open; e >> open;
+    if (open && (cur == NULL))
+      throw IllegalCheckpoint("BAB::restore");
+    delete best;
+    best = NULL;
+    if ((bp.size() > 0) && (cur != NULL)) {
+      Archive p(bp);
+      best = Path<Tracer>::replay(*cur,p,*this);
+      if (best->status(*this) != SS_SOLVED) {
+        delete best;
+        best = NULL;
+        throw IllegalCheckpoint("BAB::restore");
+      }
+      // Deletes all pending branchers
+      (void) best->choice();
+    }
+    d = 0;
+    if (!open) {
+      delete cur;
+      cur = NULL;
+      path.reset();
+    } else {
+      cur = path.restore(cur,e,*this);
+      if ((cur != NULL) && (best != NULL))
+        cur->constrain(*best);
+    }
+    // No node on the path has been constrained yet
+    mark = (best != NULL) ? path.entries() : 0;
+  }
+
   template<class Tracer>
   forceinline
   BAB<Tracer>::~BAB(void) {
@@ -68,6 +68,10 @@ namespace Gecode { namespace Search { namespace Seq {
     void reset(Space* s);
     /// Return no-goods
     NoGoods& nogoods(void);
+    /// Write checkpoint of search state to \a e
+    void checkpoint(Archive& e) const;
+    /// Restore search state from checkpoint \a e
+    void restore(Archive& e);
     /// Destructor
     ~DFS(void);
   };
@@ -136,7 +136,7 @@ namespace Gecode { namespace Search { namespace Seq {
         {
           Space* c;
           if ((d == 0) || (d >= opt.c_d)) {
-            c = cur->clone();
+            c = cur->clone(*this);
             d = 1;
           } else {
             c = NULL;
@@ -172,6 +172,38 @@ namespace Gecode { namespace Search { namespace Seq {
     assert(false);
   }
 
+  template<class Tracer>
+  forceinline void
+  DFS<Tracer>::checkpoint(Archive& e) const {
+    e << SearchTracer::EngineType::DFS;
+    Search::checkpoint(e,*this);
+    // Whether there are nodes left to explore
+    bool open = (cur != NULL) || !path.empty();
+    e << open;
+    if (open)
+      path.checkpoint(e);
+  }
+
+  template<class Tracer>
+  forceinline void
+  DFS<Tracer>::restore(Archive& e) {
+    int t; e >> t;
+    if (t != SearchTracer::EngineType::DFS)
+      throw IllegalCheckpoint("DFS::restore");
+    Search::restore(e,*this);
+    bool open; e >> open;
+    d = 0;
+    if (!open) {
+      delete cur;
+      cur = NULL;
+      path.reset();
+    } else if (cur != NULL) {
+      cur = path.restore(cur,e,*this);
+    } else {
+      throw IllegalCheckpoint("DFS::restore");
+    }
+  }
+
   template<class Tracer>
   forceinline
   DFS<Tracer>::~DFS(void) {
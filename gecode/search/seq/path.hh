@@ -55,6 +55,9 @@ namespace Gecode { namespace Search { namespace Seq {
    * distance is at least this large, an additional
    * clone is created.
    *
+   * Edges for which the last alternative has been explored are not
+   * reused. Hence the path is complete and can be saved as a checkpoint.
+   *
    */
   template<class Tracer>
   class GECODE_VTABLE_EXPORT Path : public NoGoods {
@@ -78,6 +81,8 @@ namespace Gecode { namespace Search { namespace Seq {
       Edge(void);
       /// Edge for space \a s with clone \a c (possibly NULL)
       Edge(Space* s, Space* c, unsigned int nid);
+      /// Edge for choice \a ch and alternative \a a with clone \a c (possibly NULL)
+      Edge(const Choice* ch, unsigned int a, Space* c);
 
       /// Return space for edge
       Space* space(void) const;
@@ -97,8 +102,6 @@ namespace Gecode { namespace Search { namespace Seq {
       bool rightmost(void) const;
       /// Move to next alternative
       void next(void);
-      /// Test whether current alternative was LAO
-      bool lao(void) const;
 
       /// Return node identifier
       unsigned int nid(void) const;
@@ -143,6 +146,17 @@ namespace Gecode { namespace Search { namespace Seq {
     int entries(void) const;
     /// Reset stack
     void reset(void);
+    /// Write path to current or next node to checkpoint \a e
+    void checkpoint(Archive& e) const;
+    /**
+     * \brief Restore path from checkpoint \a e for root space \a s
+     *
+     * The path takes ownership of \a s. Returns \a s if the path
+     * in the checkpoint is empty, and NULL otherwise.
+     */
+    Space* restore(Space* s, Archive& e, Worker& stat);
+    /// Return space for path from checkpoint \a e replayed on a clone of \a s
+    static Space* replay(const Space& s, Archive& e, Worker& stat);
     /// Post no-goods
     virtual void post(Space& home) const;
   };
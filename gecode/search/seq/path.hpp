@@ -46,6 +46,11 @@ namespace Gecode { namespace Search { namespace Seq {
   Path<Tracer>::Edge::Edge(Space* s, Space* c, unsigned int nid)
     : _space(c), _alt(0), _choice(s->choice()), _nid(nid) {}
 
+  template<class Tracer>
+  forceinline
+  Path<Tracer>::Edge::Edge(const Choice* ch, unsigned int a, Space* c)
+    : _space(c), _alt(a), _choice(ch), _nid(0U) {}
+
   template<class Tracer>
   forceinline Space*
   Path<Tracer>::Edge::space(void) const {
@@ -78,11 +83,6 @@ namespace Gecode { namespace Search { namespace Seq {
     return _alt+1 >= _choice->alternatives();
   }
   template<class Tracer>
-  forceinline bool
-  Path<Tracer>::Edge::lao(void) const {
-    return _alt >= _choice->alternatives();
-  }
-  template<class Tracer>
   forceinline void
   Path<Tracer>::Edge::next(void) {
     _alt++;
@@ -134,10 +134,6 @@ namespace Gecode { namespace Search { namespace Seq {
   template<class Tracer>
   forceinline const Choice*
   Path<Tracer>::push(Worker& stat, Space* s, Space* c, unsigned int nid) {
-    if (!ds.empty() && ds.top().lao()) {
-      // Topmost stack entry was LAO -> reuse
-      ds.pop().dispose();
-    }
     Edge sn(s,c,nid);
     ds.push(sn);
     stat.stack_depth(static_cast<unsigned long int>(ds.entries()));
@@ -220,6 +216,70 @@ namespace Gecode { namespace Search { namespace Seq {
       ds.pop().dispose();
   }
 
+  template<class Tracer>
+  void
+  Path<Tracer>::checkpoint(Archive& e) const {
+    e << ds.entries();
+    for (int i=0; i<ds.entries(); i++) {
+      Archive c;
+      ds[i].choice()->archive(c);
+      e << ds[i].truealt() << c.size();
+      for (int j=0; j<c.size(); j++)
+        e << c[j];
+    }
+  }
+
+  template<class Tracer>
+  Space*
+  Path<Tracer>::restore(Space* s, Archive& e, Worker& stat) {
+    reset();
+    int n; e >> n;
+    if (n == 0)
+      return s;
+    // Choices must be created by a space that has been committed to
+    Space* r = s->clone(stat);
+    for (int i=0; i<n; i++) {
+      unsigned int a; int m;
+      e >> a >> m;
+      Archive c;
+      while (m-- > 0) {
+        unsigned int w; e >> w; c << w;
+      }
+      const Choice* ch = r->choice(c);
+      if (a >= ch->alternatives()) {
+        delete ch; delete r; delete s;
+        reset();
+        throw IllegalCheckpoint("Path::restore");
+      }
+      Edge en(ch,a,(i == 0) ? s : NULL);
+      ds.push(en);
+      if (i+1 < n)
+        r->commit(*ch,a);
+    }
+    delete r;
+    stat.stack_depth(static_cast<unsigned long int>(ds.entries()));
+    return NULL;
+  }
+
+  template<class Tracer>
+  Space*
+  Path<Tracer>::replay(const Space& s, Archive& e, Worker& stat) {
+    int n; e >> n;
+    Space* r = s.clone(stat);
+    for (int i=0; i<n; i++) {
+      unsigned int a; int m;
+      e >> a >> m;
+      Archive c;
+      while (m-- > 0) {
+        unsigned int w; e >> w; c << w;
+      }
+      const Choice* ch = r->choice(c);
+      r->commit(*ch,a);
+      delete ch;
+    }
+    return r;
+  }
+
   template<class Tracer>
   forceinline Space*
   Path<Tracer>::recompute(unsigned int& d, unsigned int a_d, Worker& stat,
@@ -234,9 +294,7 @@ namespace Gecode { namespace Search { namespace Seq {
       s->commit(*ds.top().choice(),ds.top().alt());
       assert(ds.entries()-1 == lc());
       ds.top().space(NULL);
-      // Mark as reusable
-      if (static_cast<unsigned int>(ds.entries()) > ngdl())
-        ds.top().next();
+      // The edge is not reused so that the path remains complete
       d = 0;
       return s;
     }
@@ -246,7 +304,7 @@ namespace Gecode { namespace Search { namespace Seq {
     // New distance, if no adaptive recomputation
     d = static_cast<unsigned int>(n - l);
 
-    Space* s = ds[l].space()->clone(); // Last clone
+    Space* s = ds[l].space()->clone(stat); // Last clone
 
     if (d < a_d) {
       // No adaptive recomputation
@@ -276,7 +334,7 @@ namespace Gecode { namespace Search { namespace Seq {
           unwind(i,t);
           return NULL;
         }
-        ds[i].space(s->clone());
+        ds[i].space(s->clone(stat));
         d = static_cast<unsigned int>(n-i);
       }
       // Finally do the remaining commits
@@ -305,9 +363,7 @@ namespace Gecode { namespace Search { namespace Seq {
         s->constrain(best);
       }
       ds.top().space(NULL);
-      // Mark as reusable
-      if (static_cast<unsigned int>(ds.entries()) > ngdl())
-        ds.top().next();
+      // The edge is not reused so that the path remains complete
       d = 0;
       return s;
     }
@@ -333,10 +389,10 @@ namespace Gecode { namespace Search { namespace Seq {
       // It is important to replace the space on the stack with the
       // copy: a copy might be much smaller due to flushed caches
       // of propagators
-      Space* c = s->clone();
+      Space* c = s->clone(stat);
       ds[l].space(c);
     } else {
-      s = s->clone();
+      s = s->clone(stat);
     }
 
     if (d < a_d) {
@@ -370,7 +426,7 @@ namespace Gecode { namespace Search { namespace Seq {
           unwind(i,t);
           return NULL;
         }
-        ds[i].space(s->clone());
+        ds[i].space(s->clone(stat));
         d = static_cast<unsigned int>(n-i);
       }
       // Finally do the remaining commits
@@ -38,22 +38,27 @@ namespace Gecode { namespace Search {
   forceinline void
   Statistics::reset(void) {
     StatusStatistics::reset();
+    CloneStatistics::reset();
     fail=0; node=0; depth=0; restart=0; nogood=0;
+    steal_ok=0; steal_fail=0;
   }
 
   forceinline
   Statistics::Statistics(void)
     : fail(0), node(0), depth(0),
-      restart(0), nogood(0) {}
+      restart(0), nogood(0), steal_ok(0), steal_fail(0) {}
 
   forceinline Statistics&
   Statistics::operator +=(const Statistics& s) {
     (void) StatusStatistics::operator +=(s);
+    (void) CloneStatistics::operator +=(s);
     fail += s.fail;
     node += s.node;
     depth = std::max(depth,s.depth);
     restart += s.restart;
     nogood += s.nogood;
+    steal_ok += s.steal_ok;
+    steal_fail += s.steal_fail;
     return *this;
   }
 
@@ -42,6 +42,13 @@ namespace Gecode { namespace Search {
   forceinline Space*
   snapshot(Space* s, const Options& o);
 
+  /// Write statistics \a s to checkpoint \a e
+  forceinline void
+  checkpoint(Archive& e, const Statistics& s);
+  /// Read statistics \a s from checkpoint \a e
+  forceinline void
+  restore(Archive& e, Statistics& s);
+
   /// Virtualize a worker to an engine
   template<class Worker>
   class WorkerToEngine : public Engine {
@@ -63,6 +70,10 @@ namespace Gecode { namespace Search {
     virtual void reset(Space* s);
     /// Return no-goods
     virtual NoGoods& nogoods(void);
+    /// Write checkpoint of search state to \a e
+    virtual void checkpoint(Archive& e) const;
+    /// Restore search state from checkpoint \a e
+    virtual void restore(Archive& e);
   };
 
 
@@ -72,6 +83,32 @@ namespace Gecode { namespace Search {
     return o.clone ? s->clone() : s;
   }
 
+  forceinline void
+  checkpoint(Archive& e, const Statistics& s) {
+    unsigned long long int c[7] = {s.fail, s.node, s.depth, s.restart,
+                                   s.nogood, s.propagate, s.clone_bytes};
+    for (int i=0; i<7; i++)
+      e << static_cast<unsigned int>(c[i] >> 32)
+        << static_cast<unsigned int>(c[i] & 0xffffffffULL);
+  }
+
+  forceinline void
+  restore(Archive& e, Statistics& s) {
+    unsigned long long int c[7];
+    for (int i=0; i<7; i++) {
+      unsigned int h, l;
+      e >> h >> l;
+      c[i] = (static_cast<unsigned long long int>(h) << 32) | l;
+    }
+    s.fail = static_cast<unsigned long int>(c[0]);
+    s.node = static_cast<unsigned long int>(c[1]);
+    s.depth = static_cast<unsigned long int>(c[2]);
+    s.restart = static_cast<unsigned long int>(c[3]);
+    s.nogood = static_cast<unsigned long int>(c[4]);
+    s.propagate = static_cast<unsigned long int>(c[5]);
+    s.clone_bytes = static_cast<unsigned long int>(c[6]);
+  }
+
 
   template<class Worker>
   WorkerToEngine<Worker>::WorkerToEngine(Space* s, const Options& o)
@@ -106,6 +143,16 @@ namespace Gecode { namespace Search {
   WorkerToEngine<Worker>::nogoods(void) {
     return w.nogoods();
   }
+  template<class Worker>
+  void
+  WorkerToEngine<Worker>::checkpoint(Archive& e) const {
+    w.checkpoint(e);
+  }
+  template<class Worker>
+  void
+  WorkerToEngine<Worker>::restore(Archive& e) {
+    w.restore(e);
+  }
 
 }}
 
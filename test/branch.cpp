@@ -427,6 +427,33 @@ namespace Test { namespace Branch {
     return s;
   }
 
+  /// Test whether \a a and \a b have the same solutions in the same order
+  template<class TestSpace>
+  bool same(TestSpace* a, TestSpace* b, Gecode::Search::Options& o) {
+    o.a_d = Base::rand(10);
+    o.c_d = Base::rand(10);
+    Gecode::DFS<TestSpace> e_a(a, o);
+    Gecode::DFS<TestSpace> e_b(b, o);
+    delete a; delete b;
+
+    while (true) {
+      TestSpace* s_a = e_a.next();
+      TestSpace* s_b = e_b.next();
+      bool r = (s_a == NULL) == (s_b == NULL);
+      if (r && (s_a != NULL))
+        for (int i=0; i<s_a->x.size(); i++)
+          if (s_a->x[i].val() != s_b->x[i].val())
+            r = false;
+      bool done = (s_a == NULL) || (s_b == NULL);
+      delete s_a; delete s_b;
+      if (!r)
+        return false;
+      if (done)
+        break;
+    }
+    return e_a.statistics().node == e_b.statistics().node;
+  }
+
   IntTest::IntTest(const std::string& s, int a, const Gecode::IntSet& d)
     : Base("Int::Branch::"+s), arity(a), dom(d) {
   }
@@ -573,6 +600,26 @@ namespace Test { namespace Branch {
               branch(*c, c->x, tiebreak(ivbb,ivba,ivbb,ivba), ivb); break;
             }
 
+            // Selection with a heap must make the very same choices
+            if ((((vara >= 13) && (vara <= 18)) || (vara >= 27)) &&
+                (val != 3)) {
+              IntTestSpace* s = static_cast<IntTestSpace*>(root->clone());
+              IntTestSpace* h = static_cast<IntTestSpace*>(root->clone());
+              IntVarBranch ivbh(ivba);
+              ivbh.heap(true);
+              branch(*s, s->x, ivba, ivb);
+              branch(*h, h->x, ivbh, ivb);
+              Gecode::Search::Options o;
+              if (!same(s,h,o)) {
+                std::cout << "Heap selection differs: "
+                          << RunInfo(int_var_branch_name[vara],"",
+                                     int_val_branch_name[val],o)
+                          << std::endl;
+                delete c; delete root;
+                return false;
+              }
+            }
+
           }
           Gecode::Search::Options o;
           results[solutions(c,o)].push_back
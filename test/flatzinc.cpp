@@ -36,9 +36,10 @@
 namespace Test { namespace FlatZinc {
 
   FlatZincTest::FlatZincTest(const std::string& name, const std::string& source,
-                             const std::string& expected, bool allSolutions)
+                             const std::string& expected, bool allSolutions,
+                             bool stream)
     : Base("FlatZinc::"+name), _name(name), _source(source), _expected(expected),
-      _allSolutions(allSolutions) {}
+      _allSolutions(allSolutions), _stream(stream) {}
 
   bool
   FlatZincTest::run(void) {
@@ -51,7 +52,8 @@ namespace Test { namespace FlatZinc {
     Gecode::FlatZinc::FlatZincSpace* fg = NULL;
     try {
       std::stringstream ss(_source);
-      fg = Gecode::FlatZinc::parse(ss, p, olog);
+      fg = Gecode::FlatZinc::parse(ss, p, olog, NULL,
+                                   Gecode::FlatZinc::defrnd, _stream);
 
       if (fg) {
         fg->createBranchers(p, fg->solveAnnotations(), fznopt,
@@ -54,10 +54,13 @@ namespace Test {
       std::string _source;
       std::string _expected;
       bool _allSolutions;
+      /// Whether to post constraints while parsing
+      bool _stream;
     public:
       /// Construct and register test
       FlatZincTest(const std::string& name, const std::string& source,
-                   const std::string& expected, bool allSolutions = false);
+                   const std::string& expected, bool allSolutions = false,
+                   bool stream = false);
       /// Perform test
       virtual bool run(void);
     };
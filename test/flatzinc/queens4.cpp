@@ -42,7 +42,7 @@ namespace Test { namespace FlatZinc {
 
       /// Perform creation and registration
       Create(void) {
-        (void) new FlatZincTest("queens4",
+        const char* s =
 "array [1..4] of var 1..4: q :: output_array([1..4]);\n\
 var int: dq01 :: output_var;\n\
 var int: dq02 :: output_var;\n\
@@ -75,7 +75,8 @@ constraint int_ne(dq13,  2);\n\
 constraint int_ne(dq23, -1);\n\
 constraint int_ne(dq23,  1);\n\
 solve satisfy;\n\
-", "dq01 = 2;\n\
+";
+        const char* e = "dq01 = 2;\n\
 dq02 = -1;\n\
 dq03 = 1;\n\
 dq12 = -3;\n\
@@ -83,7 +84,9 @@ dq13 = -1;\n\
 dq23 = 2;\n\
 q = array1d(1..4, [3, 1, 4, 2]);\n\
 ----------\n\
-");
+";
+        (void) new FlatZincTest("queens4", s, e);
+        (void) new FlatZincTest("queens4::stream", s, e, false, true);
       }
     };
 
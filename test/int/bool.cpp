@@ -437,6 +437,43 @@ namespace Test { namespace Int {
        }
      };
 
+     /// %Test for clause database
+     class ClauseDB : public Test {
+     protected:
+       /// Clauses in DIMACS format
+       Gecode::IntArgs c;
+     public:
+       /// Construct and register test
+       ClauseDB(const std::string& s, int n, const Gecode::IntArgs& c0,
+                Gecode::IntPropLevel ipl=Gecode::IPL_DEF)
+         : Test("Bool::ClauseDB::"+
+                std::string(ipl == Gecode::IPL_ADVANCED ? "Learn::" : "")+s,
+                n,0,1,false,ipl), c(c0) {}
+       /// Check whether \a x is solution
+       virtual bool solution(const Assignment& x) const {
+         bool b = false;
+         for (int i=0; i<c.size(); i++)
+           if (c[i] == 0) {
+             if (!b)
+               return false;
+             b = false;
+           } else if (c[i] > 0) {
+             b = b || (x[c[i]-1] == 1);
+           } else {
+             b = b || (x[-c[i]-1] == 0);
+           }
+         return (c.size() == 0) || (c[c.size()-1] == 0) || b;
+       }
+       /// Post constraint
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         using namespace Gecode;
+         BoolVarArgs b(x.size());
+         for (int i=x.size(); i--; )
+           b[i]=channel(home,x[i]);
+         clause(home, b, c, ipl);
+       }
+     };
+
      /// %Test for if-then-else-constraint
      class ITEInt : public Test {
      public:
@@ -533,6 +570,42 @@ namespace Test { namespace Int {
      };
 
      Create c;
+     ClauseDB cdb_sat("Sat",6,
+                      {1,-2,3,0, -1,2,0, 2,-3,4,0, -4,5,-6,0, 6,1,0, -5,-3,0});
+     ClauseDB cdb_simplify("Simplify",6,
+                           {1,1,-2,0, 3,-3,2,0, 4,0, -1,-4,5,0, 2,5,-6});
+     ClauseDB cdb_random("Random",8,
+                         {5,4,-6,0, -6,2,-8,0, -2,-6,3,0, -4,5,7,0,
+                          -4,-7,2,0, 8,3,6,0, -5,2,-6,0, 6,3,1,0,
+                          -4,-8,5,0, 6,-7,-8,0, 4,-8,2,0, -7,4,8,0,
+                          -3,1,-2,0, 8,-6,3,0, -2,5,-6,0, 4,-1,-3,0,
+                          6,3,-5,0, -6,-4,8,0, -3,5,2,0, -3,5,1,0,
+                          2,-5,-1,0, 2,5,-1,0, -8,-5,1,0, 4,-6,3,0,
+                          -4,-6,5,0, 4,7,8,0, 2,6,8,0, -2,-7,8,0,
+                          5,-2,4,0, -8,2,6,0});
+     ClauseDB cdb_pigeon("Pigeon",6,
+                         {1,2,0, 3,4,0, 5,6,0,
+                          -1,-3,0, -1,-5,0, -3,-5,0,
+                          -2,-4,0, -2,-6,0, -4,-6,0});
+     ClauseDB cdb_random_l("Random",8,
+                           {5,4,-6,0, -6,2,-8,0, -2,-6,3,0, -4,5,7,0,
+                            -4,-7,2,0, 8,3,6,0, -5,2,-6,0, 6,3,1,0,
+                            -4,-8,5,0, 6,-7,-8,0, 4,-8,2,0, -7,4,8,0,
+                            -3,1,-2,0, 8,-6,3,0, -2,5,-6,0, 4,-1,-3,0,
+                            6,3,-5,0, -6,-4,8,0, -3,5,2,0, -3,5,1,0,
+                            2,-5,-1,0, 2,5,-1,0, -8,-5,1,0, 4,-6,3,0,
+                            -4,-6,5,0, 4,7,8,0, 2,6,8,0, -2,-7,8,0,
+                            5,-2,4,0, -8,2,6,0},
+                           Gecode::IPL_ADVANCED);
+     ClauseDB cdb_pigeon_l("Pigeon",12,
+                           {1,2,3,0, 4,5,6,0, 7,8,9,0, 10,11,12,0,
+                            -1,-4,0, -1,-7,0, -1,-10,0,
+                            -4,-7,0, -4,-10,0, -7,-10,0,
+                            -2,-5,0, -2,-8,0, -2,-11,0,
+                            -5,-8,0, -5,-11,0, -8,-11,0,
+                            -3,-6,0, -3,-9,0, -3,-12,0,
+                            -6,-9,0, -6,-12,0, -9,-12,0},
+                           Gecode::IPL_ADVANCED);
      ITEInt itebnd(Gecode::IPL_BND);
      ITEInt itedom(Gecode::IPL_DOM);
      ITEBool itebool;
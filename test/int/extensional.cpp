@@ -39,6 +39,7 @@
 
 #include <gecode/minimodel.hh>
 #include <climits>
+#include <cstdio>
 
 namespace Test { namespace Int {
 
@@ -500,6 +501,44 @@ namespace Test { namespace Int {
        }
      };
 
+     /// %Test with tuple set saved to and loaded from a file
+     class TupleSetFile : public RandomTupleSetTest {
+     protected:
+       /// The tuple set loaded from the file
+       Gecode::TupleSet lts;
+       /// Whether the loaded tuple set is equal to the original one
+       bool eq;
+     public:
+       /// Create and register test
+       TupleSetFile(const std::string& s, bool p,
+                    Gecode::IntSet d0, Gecode::TupleSet ts0)
+         : RandomTupleSetTest(s,p,d0,ts0), lts(load(ts0)),
+           eq((lts == ts0) && (lts.hash() == ts0.hash())) {}
+       /// Save tuple set \a t to a file and load it again
+       static Gecode::TupleSet load(const Gecode::TupleSet& t) {
+         std::string fn = "gecode-test-tupleset.tmp";
+         t.save(fn.c_str());
+         Gecode::TupleSet l(fn.c_str());
+         // The loaded tuple set does not depend on the file name
+         std::remove(fn.c_str());
+         return l;
+       }
+       /// Post constraint on \a x
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         using namespace Gecode;
+         if (!eq)
+           home.fail();
+         else
+           extensional(home, x, lts, pos, ipl);
+       }
+       /// Post reified constraint on \a x for \a r
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x,
+                         Gecode::Reify r) {
+         using namespace Gecode;
+         extensional(home, x, lts, pos, r, ipl);
+       }
+     };
+
      /// %Test with large tuple set
      class TupleSetLarge : public Test {
      protected:
@@ -677,6 +716,7 @@ namespace Test { namespace Int {
              TupleSet ts(4);
              ts.finalize();
              (void) new TupleSetTest("Empty",pos,IntSet(1,2),ts,true);
+             (void) new TupleSetFile("FileEmpty",pos,IntSet(1,2),ts);
            }
            {
              TupleSet ts(4);
@@ -784,6 +824,7 @@ namespace Test { namespace Int {
              t.add({1,2,3,4,4,2,1,2,3,3});
              t.finalize();
              (void) new RandomTupleSetTest("FewHuge",pos,IntSet(1,4),t);
+             (void) new TupleSetFile("File",pos,IntSet(1,4),t);
            }
            (void) new TupleSetBase(pos);
            (void) new TupleSetLarge(0.05,pos);
@@ -434,6 +434,47 @@ namespace Test {
       }
     };
 
+    /// %Test that parallel and sequential LDS find solutions in same order
+    template<class Model>
+    class LDSOrder : public Test {
+    private:
+      /// Number of threads
+      unsigned int t;
+    public:
+      /// Initialize test
+      LDSOrder(HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
+               unsigned int t0)
+        : Test("LDS::Order::"+Model::name()+"::"+
+               str(htb1)+"::"+str(htb2)+"::"+str(htb3)+"::"+str(t0),
+               htb1,htb2,htb3), t(t0) {}
+      /// Run test
+      virtual bool run(void) {
+        Model* m = new Model(htb1,htb2,htb3);
+        Gecode::Search::Options o;
+        o.d_l = 50;
+        o.threads = 1;
+        Gecode::LDS<Model> seq(m,o);
+        o.threads = t;
+        Gecode::LDS<Model> par(m,o);
+        delete m;
+        while (true) {
+          Model* s = seq.next();
+          Model* p = par.next();
+          bool same = (s == NULL) == (p == NULL);
+          if (same && (s != NULL))
+            for (int i=0; i<s->x.size(); i++)
+              if (s->x[i].val() != p->x[i].val())
+                same = false;
+          bool done = (s == NULL) || (p == NULL);
+          delete s; delete p;
+          if (!same)
+            return false;
+          if (done)
+            return true;
+        }
+      }
+    };
+
     /// %Test for best solution search
     template<class Model>
     class BAB : public Test {
@@ -480,6 +521,108 @@ namespace Test {
       }
     };
 
+    /// %Test for multi-process search
+    template<class Model, template<class> class Engine>
+    class MPS : public Test {
+    private:
+      /// Number of processes
+      unsigned int t;
+    public:
+      /// Initialize test
+      MPS(const std::string& e, HowToConstrain htc,
+          HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
+          unsigned int t0)
+        : Test("MPS::"+e+"::"+Model::name()+"::"+str(htc)+"::"+
+               str(htb1)+"::"+str(htb2)+"::"+str(htb3)+"::"+str(t0),
+               htb1,htb2,htb3,htc), t(t0) {}
+      /// Run test
+      virtual bool run(void) {
+        Model* m = new Model(htb1,htb2,htb3,htc);
+        Gecode::Search::FailStop f(2);
+        Gecode::Search::Options o;
+        o.threads = t;
+        o.stop = &f;
+        Gecode::MPS<Model,Engine> mps(m,o);
+        int n = m->solutions();
+        bool none = (n == 0);
+        delete m;
+        Model* b = NULL;
+        while (true) {
+          Model* s = mps.next();
+          if (s != NULL) {
+            n--; delete b; b = s;
+          }
+          if ((s == NULL) && !mps.stopped())
+            break;
+          f.limit(f.limit()+2);
+        }
+        if (!Engine<Model>::best)
+          return n == 0;
+        if (b == NULL)
+          return none;
+        // Workers can find different solutions of equal quality
+        bool ok = b->best();
+        if (!ok) {
+          Model* c = new Model(htb1,htb2,htb3,htc);
+          c->constrain(*b);
+          Model* d = Gecode::dfs(c);
+          ok = (d == NULL);
+          delete d;
+          delete c;
+        }
+        delete b;
+        return ok;
+      }
+    };
+
+    /// %Test for continuing search from checkpoints
+    template<class Model, template<class> class Engine>
+    class Checkpoint : public Test {
+    private:
+      /// Minimal recomputation distance
+      unsigned int c_d;
+    public:
+      /// Initialize test
+      Checkpoint(const std::string& e, HowToConstrain htc,
+                 HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
+                 unsigned int c_d0)
+        : Test("Checkpoint::"+e+"::"+Model::name()+"::"+str(htc)+"::"+
+               str(htb1)+"::"+str(htb2)+"::"+str(htb3)+"::"+str(c_d0),
+               htb1,htb2,htb3,htc), c_d(c_d0) {}
+      /// Run test
+      virtual bool run(void) {
+        Model* m = new Model(htb1,htb2,htb3,htc);
+        Gecode::Search::FailStop f(2);
+        Gecode::Search::Options o;
+        o.c_d = c_d;
+        o.threads = 1;
+        o.stop = &f;
+        Engine<Model>* e = new Engine<Model>(m,o);
+        int n = m->solutions();
+        Model* b = NULL;
+        while (true) {
+          Model* s = e->next();
+          if (s != NULL) {
+            n--; delete b; b = s;
+          }
+          if ((s == NULL) && !e->stopped())
+            break;
+          // Continue search with a new engine
+          Gecode::Archive a;
+          e->checkpoint(a);
+          delete e;
+          e = new Engine<Model>(m,o);
+          e->restore(a);
+          f.limit(f.limit()+2);
+        }
+        delete e;
+        delete m;
+        bool ok = Engine<Model>::best ? ((b == NULL) || b->best()) : (n == 0);
+        delete b;
+        return ok;
+      }
+    };
+
     /// %Test for restart-based search
     template<class Model, template<class> class Engine>
     class RBS : public Test {
@@ -516,6 +659,65 @@ namespace Test {
       }
     };
 
+    /// %Test for parallel restart-based search
+    template<class Model, template<class> class Engine>
+    class ParRBS : public Test {
+    private:
+      /// Whether best solution search is used
+      bool best;
+      /// Number of assets
+      unsigned int a;
+      /// Number of threads
+      unsigned int t;
+    public:
+      /// Initialize test
+      ParRBS(const std::string& e, bool b, unsigned int a0, unsigned int t0)
+        : Test("RBS::Par::"+e+"::"+Model::name()+"::"+
+               str(a0)+"::"+str(t0),
+               HTB_BINARY,HTB_BINARY,HTB_BINARY), best(b), a(a0), t(t0) {}
+      /// Run test
+      virtual bool run(void) {
+        Model* m = new Model(htb1,htb2,htb3);
+        Gecode::Search::FailStop f(2);
+        Gecode::Search::Options o;
+        o.assets = a;
+        o.threads = t;
+        o.d_l = 100;
+        o.stop = &f;
+        o.cutoff = Gecode::Search::Cutoff::geometric(1,2);
+        Gecode::RBS<Model,Engine> rbs(m,o);
+        if (best) {
+          Model* b = NULL;
+          while (true) {
+            Model* s = rbs.next();
+            if (s != NULL) {
+              delete b; b=s;
+            }
+            if ((s == NULL) && !rbs.stopped())
+              break;
+            f.limit(f.limit()+2);
+          }
+          bool ok = (b == NULL) || b->best();
+          delete b;
+          delete m;
+          return ok;
+        } else {
+          int n = std::min(a,t) * m->solutions();
+          delete m;
+          while (true) {
+            Model* s = rbs.next();
+            if (s != NULL) {
+              n--; delete s;
+            }
+            if ((s == NULL) && !rbs.stopped())
+              break;
+            f.limit(f.limit()+2);
+          }
+          return n >= 0;
+        }
+      }
+    };
+
     /// %Test for portfolio-based search
     template<class Model, template<class> class Engine>
     class PBS : public Test {
@@ -733,6 +935,12 @@ namespace Test {
           new LDS<FailImmediate>(HTB_NONE, HTB_NONE, HTB_NONE, t);
           new LDS<HasSolutions>(HTB_NONE, HTB_NONE, HTB_NONE, t);
         }
+        for (unsigned int t = 2; t<=4; t++)
+          for (BranchTypes htb1; htb1(); ++htb1)
+            for (BranchTypes htb2; htb2(); ++htb2)
+              for (BranchTypes htb3; htb3(); ++htb3)
+                (void) new LDSOrder<HasSolutions>(htb1.htb(),htb2.htb(),
+                                                  htb3.htb(),t);
 
         // Best solution search
         for (unsigned int t = 1; t<=4; t++)
@@ -753,6 +961,46 @@ namespace Test {
               (void) new BAB<HasSolutions>
                 (HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,c_d,a_d,t);
             }
+        // Checkpoints
+        for (unsigned int c_d=1; c_d<=3; c_d += 2) {
+          for (BranchTypes htb1; htb1(); ++htb1)
+            for (BranchTypes htb2; htb2(); ++htb2)
+              for (BranchTypes htb3; htb3(); ++htb3) {
+                (void) new Checkpoint<HasSolutions,Gecode::DFS>
+                  ("DFS",HTC_NONE,htb1.htb(),htb2.htb(),htb3.htb(),c_d);
+                for (ConstrainTypes htc; htc(); ++htc)
+                  (void) new Checkpoint<HasSolutions,Gecode::BAB>
+                    ("BAB",htc.htc(),htb1.htb(),htb2.htb(),htb3.htb(),c_d);
+              }
+          (void) new Checkpoint<FailImmediate,Gecode::DFS>
+            ("DFS",HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,c_d);
+          (void) new Checkpoint<SolveImmediate,Gecode::DFS>
+            ("DFS",HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,c_d);
+          (void) new Checkpoint<FailImmediate,Gecode::BAB>
+            ("BAB",HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,c_d);
+          (void) new Checkpoint<SolveImmediate,Gecode::BAB>
+            ("BAB",HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,c_d);
+        }
+        // Multi-process search
+        for (unsigned int t=1; t<=3; t++) {
+          for (BranchTypes htb1; htb1(); ++htb1)
+            for (BranchTypes htb2; htb2(); ++htb2)
+              for (BranchTypes htb3; htb3(); ++htb3) {
+                (void) new MPS<HasSolutions,Gecode::DFS>
+                  ("DFS",HTC_NONE,htb1.htb(),htb2.htb(),htb3.htb(),t);
+                for (ConstrainTypes htc; htc(); ++htc)
+                  (void) new MPS<HasSolutions,Gecode::BAB>
+                    ("BAB",htc.htc(),htb1.htb(),htb2.htb(),htb3.htb(),t);
+              }
+          (void) new MPS<FailImmediate,Gecode::DFS>
+            ("DFS",HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,t);
+          (void) new MPS<SolveImmediate,Gecode::DFS>
+            ("DFS",HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,t);
+          (void) new MPS<FailImmediate,Gecode::BAB>
+            ("BAB",HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,t);
+          (void) new MPS<SolveImmediate,Gecode::BAB>
+            ("BAB",HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,t);
+        }
         // Restart-based search
         for (unsigned int t=1; t<=4; t++) {
           (void) new RBS<HasSolutions,Gecode::DFS>("DFS",t);
@@ -765,6 +1013,16 @@ namespace Test {
           (void) new RBS<SolveImmediate,Gecode::LDS>("LDS",t);
           (void) new RBS<SolveImmediate,Gecode::BAB>("BAB",t);
         }
+        // Parallel restart-based search
+        for (unsigned int a=2; a<=4; a++)
+          for (unsigned int t=2; t<=2*a; t++) {
+            (void) new ParRBS<HasSolutions,Gecode::DFS>("DFS",false,a,t);
+            (void) new ParRBS<HasSolutions,Gecode::BAB>("BAB",true,a,t);
+            (void) new ParRBS<FailImmediate,Gecode::DFS>("DFS",false,a,t);
+            (void) new ParRBS<FailImmediate,Gecode::BAB>("BAB",true,a,t);
+            (void) new ParRBS<SolveImmediate,Gecode::DFS>("DFS",false,a,t);
+            (void) new ParRBS<SolveImmediate,Gecode::BAB>("BAB",true,a,t);
+          }
         // Portfolio-based search
         for (unsigned int a=1; a<=4; a++)
           for (unsigned int t=1; t<=2*a; t++) {
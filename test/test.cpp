@@ -40,7 +40,11 @@
 #endif
 
 #include <iostream>
+#include <fstream>
+#include <sstream>
 
+#include <algorithm>
+#include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <ctime>
@@ -115,6 +119,14 @@ namespace Test {
   std::vector<std::pair<MatchType, const char*> > testpat;
   const char* startFrom = NULL;
   bool list = false;
+  /// Number of processes running tests in parallel
+  unsigned int jobs = 1;
+  /// Number of shards the tests are split into
+  unsigned int shards = 1;
+  /// Shard to be run
+  unsigned int shard = 0;
+  /// File to write timing information to (NULL if none)
+  const char* timing = NULL;
 
   void
   Options::parse(int argc, char* argv[]) {
@@ -155,6 +167,20 @@ namespace Test {
                   << "\t\tstop on first error or continue" << std::endl
                   << "\t-list" << std::endl
                   << "\t\toutput list of all test cases and exit" << std::endl
+                  << "\t-jobs (unsigned int) default: " << jobs << std::endl
+                  << "\t\tnumber of processes running tests in parallel"
+                  << std::endl
+                  << "\t\t0 runs one process per processor" << std::endl
+                  << "\t-shards (unsigned int) default: " << shards
+                  << std::endl
+                  << "\t\tnumber of shards the tests are split into"
+                  << std::endl
+                  << "\t-shard (unsigned int) default: " << shard << std::endl
+                  << "\t\tshard of tests to run (from 0 to shards-1)"
+                  << std::endl
+                  << "\t-timing (string) default: (none)" << std::endl
+                  << "\t\tfile to write the wall time of each test to (JSON)"
+                  << std::endl
           ;
         exit(EXIT_SUCCESS);
       } else if (!strcmp(argv[i],"-seed")) {
@@ -192,6 +218,20 @@ namespace Test {
         }
       } else if (!strcmp(argv[i],"-list")) {
         list = true;
+      } else if (!strcmp(argv[i],"-jobs")) {
+        if (++i == argc) goto missing;
+        jobs = static_cast<unsigned int>(atoi(argv[i]));
+        if (jobs == 0)
+          jobs = Gecode::Support::Thread::npu();
+      } else if (!strcmp(argv[i],"-shards")) {
+        if (++i == argc) goto missing;
+        shards = std::max(static_cast<unsigned int>(atoi(argv[i])),1U);
+      } else if (!strcmp(argv[i],"-shard")) {
+        if (++i == argc) goto missing;
+        shard = static_cast<unsigned int>(atoi(argv[i]));
+      } else if (!strcmp(argv[i],"-timing")) {
+        if (++i == argc) goto missing;
+        timing = argv[i];
       }
       i++;
     }
@@ -202,6 +242,275 @@ namespace Test {
     exit(EXIT_FAILURE);
   }
 
+  /// Return seed for test with name \a n derived from seed \a s
+  unsigned int
+  seed(unsigned int s, const std::string& n) {
+    // FNV-1a hash of the name, starting from the seed
+    unsigned int h = 2166136261U ^ s;
+    for (std::string::size_type i=0; i<n.size(); i++) {
+      h ^= static_cast<unsigned char>(n[i]);
+      h *= 16777619U;
+    }
+    return h;
+  }
+
+  /// Test whether test \a t matches the test patterns
+  bool
+  match(Base* t) {
+    if (testpat.size() == 0)
+      return true;
+    bool match_found   = false;
+    bool some_positive = false;
+    for (unsigned int i = 0; i < testpat.size(); ++i) {
+      if (testpat[i].first == MT_NOT) { // Negative pattern
+        if (t->name().find(testpat[i].second) != std::string::npos)
+          return false;
+      } else {               // Positive pattern
+        some_positive = true;
+        if (((testpat[i].first == MT_ANY) &&
+             (t->name().find(testpat[i].second) != std::string::npos)) ||
+            ((testpat[i].first == MT_FIRST) &&
+             (t->name().find(testpat[i].second) == 0)))
+          match_found = true;
+      }
+    }
+    return !some_positive || match_found;
+  }
+
+  /// Outcome of running a test
+  enum Outcome {
+    OC_PASSED,   ///< All iterations passed
+    OC_FAILED,   ///< Some iteration failed
+    OC_EXCEPTION ///< Test threw an exception
+  };
+
+  /// Run test \a t and return its outcome
+  Outcome
+  run(Base* t) {
+    Outcome oc = OC_PASSED;
+    // Every test has its own seed, independent of other tests being run
+    Base::rand.seed(seed(opt.seed,t->name()));
+    std::cout << t->name() << " ";
+    std::cout.flush();
+    try {
+      for (unsigned int i = opt.iter; i--; ) {
+        if (t->run()) {
+          std::cout << '+';
+          std::cout.flush();
+        } else {
+          std::cout << "-" << std::endl;
+          report_error(t->name());
+          oc = OC_FAILED;
+          if (opt.stop)
+            return oc;
+        }
+      }
+    } catch (Gecode::Exception e) {
+      std::cout << "Exception in \"Gecode::" << e.what()
+                << "." << std::endl
+                << "Stopping..." << std::endl;
+      report_error(t->name());
+      return OC_EXCEPTION;
+    }
+    return oc;
+  }
+
+  /// Write string \a s as JSON string to \a os
+  void
+  json(std::ostream& os, const std::string& s) {
+    os << '"';
+    for (std::string::size_type i=0; i<s.size(); i++)
+      switch (s[i]) {
+      case '"':  os << "\\\""; break;
+      case '\\': os << "\\\\"; break;
+      default:
+        if (static_cast<unsigned char>(s[i]) < 0x20) {
+          char u[8];
+          sprintf(u, "\\u%04x", static_cast<unsigned char>(s[i]));
+          os << u;
+        } else {
+          os << s[i];
+        }
+      }
+    os << '"';
+  }
+
+  /**
+   * \brief Timing file
+   *
+   * The file contains a JSON object with one test per line so that
+   * the timing files of several shards can be merged easily.
+   */
+  class Timing {
+  protected:
+    /// The output file
+    std::ofstream os;
+    /// Number of tests written
+    unsigned int n;
+  public:
+    /// Open timing file \a fn
+    Timing(const char* fn);
+    /// Write test entry \a e
+    void entry(const std::string& e);
+    /// Write test \a t with time \a ms and outcome \a oc
+    void test(Base* t, double ms, Outcome oc);
+    /// Close file
+    ~Timing(void);
+  };
+
+  Timing::Timing(const char* fn) : os(fn), n(0) {
+    os << "{\"seed\":" << opt.seed << ",\"iter\":" << opt.iter
+       << ",\"tests\":[";
+  }
+  void
+  Timing::entry(const std::string& e) {
+    os << ((n++ > 0) ? ",\n" : "\n") << e;
+  }
+  void
+  Timing::test(Base* t, double ms, Outcome oc) {
+    std::ostringstream e;
+    e << "{\"name\":";
+    json(e,t->name());
+    e << ",\"time\":" << ms << ",\"status\":\""
+      << ((oc == OC_PASSED) ? "passed" :
+          ((oc == OC_FAILED) ? "failed" : "exception"))
+      << "\"}";
+    entry(e.str());
+  }
+  Timing::~Timing(void) {
+    os << "\n]}" << std::endl;
+  }
+
+  /// Return argument \a a quoted for the command line
+  std::string
+  quote(const std::string& a) {
+#ifdef GECODE_THREADS_WINDOWS
+    std::string q = "\"";
+    for (std::string::size_type i=0; i<a.size(); i++)
+      if (a[i] == '"')
+        q += "\\\"";
+      else
+        q += a[i];
+    return q + "\"";
+#else
+    std::string q = "'";
+    for (std::string::size_type i=0; i<a.size(); i++)
+      if (a[i] == '\'')
+        q += "'\\''";
+      else
+        q += a[i];
+    return q + "'";
+#endif
+  }
+
+  /// Name of log or timing file \a f for shard \a i
+  std::string
+  shardfile(const std::string& f, unsigned int i) {
+    std::ostringstream s;
+    s << f << "." << i;
+    return s.str();
+  }
+
+  /// Job running a shard of tests in a separate process
+  class ShardJob : public Gecode::Support::Job<int> {
+  protected:
+    /// The command line (without the shard)
+    std::string cmd;
+  public:
+    /// Initialize with command \a c
+    ShardJob(const std::string& c) : cmd(c) {}
+    /// Run shard \a i
+    virtual int run(int i) {
+      std::ostringstream c;
+      c << cmd << " -jobs 1 -shards " << jobs << " -shard " << i;
+      if (timing != NULL)
+        c << " -timing " << quote(shardfile(timing,i));
+      c << " > " << quote(shardfile("gecode-test-shard.log",i)) << " 2>&1";
+      return system(c.str().c_str());
+    }
+  };
+
+  /// Iterator over shard jobs
+  class ShardJobs {
+  protected:
+    /// The command line
+    std::string cmd;
+    /// Next shard
+    unsigned int i;
+  public:
+    /// Initialize with command \a c
+    ShardJobs(const std::string& c) : cmd(c), i(0) {}
+    /// Test whether there are more shards
+    bool operator ()(void) const {
+      return i < jobs;
+    }
+    /// Return job for next shard
+    ShardJob* job(void) {
+      i++;
+      return new ShardJob(cmd);
+    }
+  };
+
+  /// Run all shards in parallel processes and return exit code
+  int
+  runjobs(int argc, char* argv[]) {
+    // All shards use the same seed
+    std::ostringstream c;
+    for (int i=0; i<argc; i++)
+      c << quote(argv[i]) << " ";
+    c << "-seed " << opt.seed;
+
+    Gecode::Support::Timer t;
+    t.start();
+    int failed = 0;
+    {
+      ShardJobs sjs(c.str());
+      Gecode::Support::RunJobs<ShardJobs,int> rj(sjs,jobs);
+      int r;
+      while (rj.run(r))
+        if (r != 0)
+          failed++;
+    }
+    double ms = t.stop();
+
+    // Output logs of shards
+    for (unsigned int i=0; i<jobs; i++) {
+      std::string l = shardfile("gecode-test-shard.log",i);
+      std::ifstream is(l.c_str());
+      std::cout << is.rdbuf();
+      is.close();
+      remove(l.c_str());
+    }
+
+    // Merge timing files
+    if (timing != NULL) {
+      std::vector<std::string> es;
+      for (unsigned int i=0; i<jobs; i++) {
+        std::string f = shardfile(timing,i);
+        std::ifstream is(f.c_str());
+        std::string e;
+        while (std::getline(is,e))
+          if (e.compare(0,8,"{\"name\":") == 0) {
+            if (e[e.size()-1] == ',')
+              e.erase(e.size()-1);
+            es.push_back(e);
+          }
+        is.close();
+        remove(f.c_str());
+      }
+      std::sort(es.begin(),es.end());
+      Timing tf(timing);
+      for (unsigned int i=0; i<es.size(); i++)
+        tf.entry(es[i]);
+    }
+
+    std::cout << "Ran " << jobs << " shards in " << ms << " ms";
+    if (failed > 0)
+      std::cout << ", " << failed << " failed";
+    std::cout << std::endl;
+    return (failed > 0) ? 1 : 0;
+  }
+
 }
 
 int
@@ -222,61 +531,45 @@ main(int argc, char* argv[]) {
     exit(EXIT_SUCCESS);
   }
 
-  Base::rand.seed(opt.seed);
+  if (shard >= shards) {
+    std::cerr << "Error: shard must be between 0 and " << shards-1
+              << std::endl;
+    return 1;
+  }
+
+  if (jobs > 1)
+    return runjobs(argc, argv);
+
+  Timing* tf = (timing != NULL) ? new Timing(timing) : NULL;
 
   bool started = startFrom == NULL ? true : false;
+  // Number of tests that match
+  unsigned int n = 0;
 
   for (Base* t = Base::tests() ; t != NULL; t = t->next() ) {
-    try {
-      if (!started) {
-        if (t->name().find(startFrom) != std::string::npos)
-          started = true;
-        else
-          goto next;
-      }
-      if (testpat.size() != 0) {
-        bool match_found   = false;
-        bool some_positive = false;
-        for (unsigned int i = 0; i < testpat.size(); ++i) {
-          if (testpat[i].first == MT_NOT) { // Negative pattern
-            if (t->name().find(testpat[i].second) != std::string::npos)
-              goto next;
-          } else {               // Positive pattern
-            some_positive = true;
-            if (((testpat[i].first == MT_ANY) &&
-                 (t->name().find(testpat[i].second) != std::string::npos)) ||
-                ((testpat[i].first == MT_FIRST) &&
-                 (t->name().find(testpat[i].second) == 0)))
-              match_found = true;
-          }
-        }
-        if (some_positive && !match_found) goto next;
-      }
-      std::cout << t->name() << " ";
-      std::cout.flush();
-      for (unsigned int i = opt.iter; i--; ) {
-        opt.seed = Base::rand.seed();
-        if (t->run()) {
-          std::cout << '+';
-          std::cout.flush();
-        } else {
-          std::cout << "-" << std::endl;
-          report_error(t->name());
-          if (opt.stop)
-            return 1;
-        }
-      }
-    std::cout << std::endl;
-    } catch (Gecode::Exception e) {
-      std::cout << "Exception in \"Gecode::" << e.what()
-                << "." << std::endl
-                << "Stopping..." << std::endl;
-      report_error(t->name());
-      if (opt.stop)
-        return 1;
+    if (!started) {
+      if (t->name().find(startFrom) != std::string::npos)
+        started = true;
+      else
+        continue;
+    }
+    if (!match(t) || ((n++ % shards) != shard))
+      continue;
+    Gecode::Support::Timer timer;
+    timer.start();
+    Outcome oc = run(t);
+    double ms = timer.stop();
+    if (tf != NULL)
+      tf->test(t,ms,oc);
+    if ((oc != OC_PASSED) && opt.stop) {
+      delete tf;
+      return 1;
     }
-  next:;
+    if (tf != NULL)
+      std::cout << " (" << ms << " ms)";
+    std::cout << std::endl;
   }
+  delete tf;
   return 0;
 }
 